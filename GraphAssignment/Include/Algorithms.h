@@ -5,6 +5,8 @@
 #define ALGORITHMS_H
 
 #include "Graph.h"
+#include "CompressedGraph.h"
+#include "DirectedGraph.h"
 #include "GraphException.h"
 
 namespace graph {
@@ -16,6 +18,8 @@ namespace graph {
  * any state. All methods are static and work on Graph objects passed as parameters.
  * The algorithms are implemented to work specifically with undirected weighted graphs
  * and return their results as new Graph objects representing trees or subgraphs.
+ * Traversals and shortest paths are also provided for DirectedGraph, following
+ * out-edges or, in the reverse variants, in-edges; they return DirectedGraph trees.
  * 
  * @note All algorithms assume the input graph is connected for optimal results
  * @note The class uses custom data structures (Queue, PriorityQueue, UnionFind) instead of STL
@@ -41,6 +45,21 @@ public:
      */
     static Graph bfs(const Graph& g, int start);
 
+    /**
+     * @brief Perform Breadth-First Search on a compressed graph
+     * 
+     * Same result as bfs(const Graph&, int), with neighbors decoded from the
+     * compressed representation into a single reused buffer.
+     * 
+     * @param g The compressed input graph to traverse
+     * @param start The starting vertex for BFS (0-based index)
+     * @return Graph A new Graph object representing the BFS spanning tree
+     * @throws GraphException if start vertex is invalid
+     * 
+     * @complexity Time: O(V + E), Space: O(V + D) with D the maximum degree
+     */
+    static Graph bfs(const CompressedGraph& g, int start);
+
     /**
      * @brief Perform Depth-First Search starting from a given vertex
      * 
@@ -53,9 +72,12 @@ public:
      * @return Graph A new Graph object representing the DFS spanning tree/forest
      * @throws GraphException if start vertex is invalid
      * 
-     * @complexity Time: O(V + E), Space: O(V)
+     * @complexity Time: O(V + E), Space: O(V + P) with P the total degree of
+     *             the vertices on the deepest DFS path
      * @note The returned graph contains only tree edges, not back/forward/cross edges
      * @note If graph is disconnected, result may be a forest
+     * @note The search uses an explicit stack, so path depth is not limited by
+     *       the call stack
      */
     static Graph dfs(const Graph& g, int start);
 
@@ -70,14 +92,115 @@ public:
      * @param start The source vertex (0-based index)
      * @return Graph A new Graph object representing the shortest-path tree
      * @throws GraphException if start vertex is invalid
-     * @throws GraphException if graph contains negative edge weights
+     * @throws GraphException if an edge reachable from start has a negative weight
      * 
      * @complexity Time: O(V²), Space: O(V)
-     * @note Assumes all edge weights are non-negative
+     * @note For negative weights use ShortestPaths::bellmanFord() or ShortestPaths::spfa()
      * @note Uses a custom priority queue implementation
+     * @note If every edge has weight 1 (see Graph::isUnweighted()) the tree is
+     *       computed by BFS in O(V + E); GRAPH_UNWEIGHTED builds always do so
      */
     static Graph dijkstra(const Graph& g, int start);
 
+    /**
+     * @brief Find shortest paths on a compressed graph using Dijkstra's algorithm
+     * 
+     * Same result as dijkstra(const Graph&, int), with neighbors decoded from
+     * the compressed representation into a single reused buffer.
+     * 
+     * @param g The compressed input graph (must have non-negative edge weights)
+     * @param start The source vertex (0-based index)
+     * @return Graph A new Graph object representing the shortest-path tree
+     * @throws GraphException if start vertex is invalid
+     * @throws GraphException if an edge reachable from start has a negative weight
+     * 
+     * @complexity Time: O(E log E), Space: O(V + E)
+     */
+    static Graph dijkstra(const CompressedGraph& g, int start);
+
+    /**
+     * @brief Perform Breadth-First Search over the out-edges of a directed graph
+     * 
+     * @param g The directed input graph
+     * @param start The starting vertex (0-based index)
+     * @return DirectedGraph Tree of edges parent -> child reaching every vertex reachable from start
+     * @throws GraphException if start vertex is invalid
+     * 
+     * @complexity Time: O(V + E), Space: O(V + D) with D the maximum out-degree
+     */
+    static DirectedGraph bfs(const DirectedGraph& g, int start);
+
+    /**
+     * @brief Perform Breadth-First Search over the in-edges of a directed graph
+     * 
+     * Finds every vertex that can reach target, using the in-adjacency
+     * directly instead of building the transposed graph.
+     * 
+     * @param g The directed input graph
+     * @param target The vertex the search starts from (0-based index)
+     * @return DirectedGraph Tree of original edges child -> parent; the tree
+     *         path from each vertex is a fewest-edges path to target
+     * @throws GraphException if target vertex is invalid
+     * 
+     * @complexity Time: O(V + E), Space: O(V + D) with D the maximum in-degree
+     */
+    static DirectedGraph reverseBfs(const DirectedGraph& g, int target);
+
+    /**
+     * @brief Perform Depth-First Search over the out-edges of a directed graph
+     * 
+     * @param g The directed input graph
+     * @param start The starting vertex (0-based index)
+     * @return DirectedGraph Tree of edges parent -> child discovered by DFS
+     * @throws GraphException if start vertex is invalid
+     * 
+     * @complexity Time: O(V + E), Space: O(V + P) with P the total out-degree
+     *             of the vertices on the deepest DFS path (explicit stack)
+     */
+    static DirectedGraph dfs(const DirectedGraph& g, int start);
+
+    /**
+     * @brief Perform Depth-First Search over the in-edges of a directed graph
+     * 
+     * @param g The directed input graph
+     * @param target The vertex the search starts from (0-based index)
+     * @return DirectedGraph Tree of original edges child -> parent discovered by DFS
+     * @throws GraphException if target vertex is invalid
+     * 
+     * @complexity Time: O(V + E), Space: O(V + P) with P the total in-degree
+     *             of the vertices on the deepest DFS path (explicit stack)
+     */
+    static DirectedGraph reverseDfs(const DirectedGraph& g, int target);
+
+    /**
+     * @brief Find shortest paths from a source over the out-edges of a directed graph
+     * 
+     * @param g The directed input graph (must have non-negative edge weights)
+     * @param start The source vertex (0-based index)
+     * @return DirectedGraph Shortest-path tree of edges parent -> child
+     * @throws GraphException if start vertex is invalid
+     * @throws GraphException if an edge reachable from start has a negative weight
+     * 
+     * @complexity Time: O(E log E), Space: O(V + E)
+     * @note With unit weights (see DirectedGraph::isUnweighted()) the tree is computed by BFS
+     */
+    static DirectedGraph dijkstra(const DirectedGraph& g, int start);
+
+    /**
+     * @brief Find shortest paths to a target over the in-edges of a directed graph
+     * 
+     * @param g The directed input graph (must have non-negative edge weights)
+     * @param target The destination vertex (0-based index)
+     * @return DirectedGraph Tree of original edges child -> parent; the tree
+     *         path from each vertex is a shortest path to target
+     * @throws GraphException if target vertex is invalid
+     * @throws GraphException if an edge that reaches target has a negative weight
+     * 
+     * @complexity Time: O(E log E), Space: O(V + E)
+     * @note With unit weights (see DirectedGraph::isUnweighted()) the tree is computed by BFS
+     */
+    static DirectedGraph reverseDijkstra(const DirectedGraph& g, int target);
+
     /**
      * @brief Find Minimum Spanning Tree using Prim's algorithm
      * 
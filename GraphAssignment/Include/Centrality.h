@@ -0,0 +1,164 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef CENTRALITY_H
+#define CENTRALITY_H
+
+#include "Graph.h"
+#include "DirectedGraph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class computing vertex centrality scores
+ *
+ * The scoring functions return one score per vertex ID as a dynamically
+ * allocated array of getVertexCount() entries that must be deleted by the caller.
+ * Loops over vertices run in parallel when built with OpenMP (-fopenmp),
+ * reusing the OpenMP thread team across iterations.
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated and score 0
+ * @note No STL containers are used in this implementation
+ */
+class Centrality {
+public:
+    /**
+     * @brief Compute PageRank
+     *
+     * Power iteration of rank(v) = (1 - d) / N + d * sum(rank(u) / deg(u))
+     * over the neighbors u of v, where N is the number of active vertices.
+     * The rank of vertices without edges is redistributed uniformly. Each
+     * iteration pulls contributions along the edges into a second buffer, with
+     * the edges grouped by blocks of source IDs so that the contributions
+     * read by one block stay in cache.
+     *
+     * @param g The input graph (each undirected edge is followed both ways)
+     * @param damping Probability d of following an edge (in [0, 1])
+     * @param tolerance Stop when the L1 change of one iteration is below this
+     * @param maxIterations Upper bound on the number of iterations (>= 0)
+     * @return double* Ranks summing to 1 (must be deleted by caller)
+     * @throws GraphException if damping is outside [0, 1] or maxIterations < 0
+     *
+     * @complexity Time: O((V + E) * iterations), Space: O(V + E)
+     */
+    static double* pageRank(const Graph& g, double damping = 0.85,
+                            double tolerance = 1e-10, int maxIterations = 100);
+
+    /**
+     * @brief Compute PageRank on a directed graph
+     *
+     * Same as pageRank(const Graph&, ...), following out-edges; ranks are
+     * pulled over the in-adjacency.
+     *
+     * @param g The directed input graph
+     * @param damping Probability d of following an edge (in [0, 1])
+     * @param tolerance Stop when the L1 change of one iteration is below this
+     * @param maxIterations Upper bound on the number of iterations (>= 0)
+     * @return double* Ranks summing to 1 (must be deleted by caller)
+     * @throws GraphException if damping is outside [0, 1] or maxIterations < 0
+     *
+     * @complexity Time: O((V + E) * iterations), Space: O(V + E)
+     */
+    static double* pageRank(const DirectedGraph& g, double damping = 0.85,
+                            double tolerance = 1e-10, int maxIterations = 100);
+
+    /**
+     * @brief Compute personalized PageRank
+     *
+     * As pageRank(), but every jump (and the rank of vertices without edges)
+     * goes to the teleport distribution instead of a uniform vertex.
+     *
+     * @param g The input graph
+     * @param teleport Non-negative per-vertex weights, normalized internally
+     *                 (e.g. 1 at a single seed vertex and 0 elsewhere)
+     * @param damping Probability d of following an edge (in [0, 1])
+     * @param tolerance Stop when the L1 change of one iteration is below this
+     * @param maxIterations Upper bound on the number of iterations (>= 0)
+     * @return double* Ranks summing to 1 (must be deleted by caller)
+     * @throws GraphException if teleport has a negative entry or sums to 0,
+     *         or on invalid damping / maxIterations
+     *
+     * @complexity Time: O((V + E) * iterations), Space: O(V + E)
+     */
+    static double* personalizedPageRank(const Graph& g, const double* teleport,
+                                        double damping = 0.85, double tolerance = 1e-10,
+                                        int maxIterations = 100);
+
+    /**
+     * @brief Compute PageRank with transitions proportional to edge weights
+     *
+     * A walk at u moves to neighbor v with probability w(u, v) / W(u), where
+     * W(u) is the total weight of the edges at u. Vertices with W(u) = 0 are
+     * treated as having no edges.
+     *
+     * @param g The input graph (weights must be non-negative)
+     * @param damping Probability d of following an edge (in [0, 1])
+     * @param tolerance Stop when the L1 change of one iteration is below this
+     * @param maxIterations Upper bound on the number of iterations (>= 0)
+     * @return double* Ranks summing to 1 (must be deleted by caller)
+     * @throws GraphException if an edge weight is negative, or on invalid damping / maxIterations
+     *
+     * @complexity Time: O((V + E) * iterations), Space: O(V + E)
+     */
+    static double* weightedPageRank(const Graph& g, double damping = 0.85,
+                                    double tolerance = 1e-10, int maxIterations = 100);
+
+    /**
+     * @brief Compute exact betweenness centrality (Brandes' algorithm)
+     *
+     * The betweenness of v is the sum, over all unordered pairs {s, t} of
+     * other vertices, of the fraction of shortest s-t paths passing through
+     * v. One shortest-path search runs from every vertex: BFS if every edge
+     * has weight 1 (see Graph::isUnweighted()), Dijkstra otherwise. Path
+     * counts are then propagated back in reverse search order. The sources
+     * are distributed over threads, each with its own search arrays and
+     * score accumulator, and the accumulators are summed at the end.
+     *
+     * @param g The input graph (weights must be positive if not all 1)
+     * @return double* Betweenness scores (must be deleted by caller)
+     * @throws GraphException if the graph has a weight <= 0 and is not unweighted
+     *
+     * @complexity Time: O(V * E) unweighted, O(V * E log E) weighted, Space: O(T * V + E) for T threads
+     */
+    static double* betweenness(const Graph& g);
+
+    /**
+     * @brief Estimate betweenness centrality from a sample of sources
+     *
+     * Runs the Brandes search from 'samples' distinct source vertices chosen
+     * uniformly at random and scales the accumulated scores by
+     * (active vertices) / samples, which gives an unbiased estimate of
+     * betweenness(). See betweennessErrorBound() for the accuracy.
+     *
+     * @param g The input graph (weights must be positive if not all 1)
+     * @param samples Number of sources (values above the vertex count give the exact result)
+     * @param seed Seed of the pseudo-random source selection
+     * @return double* Estimated betweenness scores (must be deleted by caller)
+     * @throws GraphException if samples <= 0, or on invalid weights as betweenness()
+     *
+     * @complexity Time: O(samples * E) unweighted, O(samples * E log E) weighted
+     */
+    static double* approximateBetweenness(const Graph& g, int samples, unsigned int seed = 1);
+
+    /**
+     * @brief Error bound of approximateBetweenness()
+     *
+     * Each sampled source contributes a value in [0, N(N-2)/2] to the scaled
+     * estimate, so by Hoeffding's inequality and a union bound over the N
+     * vertices, with probability at least 1 - failureProbability every
+     * estimate is within N(N-2)/2 * sqrt(ln(2N / failureProbability) / (2 * samples))
+     * of the exact betweenness.
+     *
+     * @param vertices Number of active vertices N
+     * @param samples Number of sampled sources (> 0)
+     * @param failureProbability Allowed failure probability, in (0, 1)
+     * @return double The absolute error bound
+     * @throws GraphException on a non-positive sample count or a probability outside (0, 1)
+     */
+    static double betweennessErrorBound(int vertices, int samples, double failureProbability);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,152 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef COLORING_H
+#define COLORING_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class for vertex coloring and maximal independent sets
+ *
+ * A coloring assigns every vertex a color so that adjacent vertices get
+ * different colors. Colorings are returned as a dynamically allocated array
+ * of getVertexCount() colors, from 0 to (colors - 1), that must be deleted
+ * by the caller. All functions color greedily: a vertex takes the smallest
+ * color not used by its already colored neighbors, so at most
+ * getMaxDegree() + 1 colors are used; they differ in the vertex order.
+ *
+ * Maximal independent sets (no two members adjacent, and every other
+ * vertex adjacent to a member) are returned as per-vertex flags.
+ *
+ * Self-loops are ignored (a vertex with a self-loop cannot be colored
+ * properly) and parallel edges are treated as one edge.
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated and get color 0
+ * @note No STL containers are used in this implementation
+ */
+class Coloring {
+public:
+    /**
+     * @brief Greedy coloring in largest-degree-first order
+     *
+     * Vertices are colored by decreasing degree, ties by increasing ID.
+     *
+     * @param g The input graph
+     * @param colors Reference to store the number of colors used
+     * @return int* Color of every vertex (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static int* largestFirst(const Graph& g, int& colors);
+
+    /**
+     * @brief Greedy coloring in smallest-last order
+     *
+     * Vertices are removed one at a time by minimum remaining degree, as in
+     * Cores::coreNumbers(), and colored in the reverse order of removal.
+     * Every vertex then has at most degeneracy(g) colored neighbors when it
+     * is colored, so at most Cores::degeneracy(g) + 1 colors are used.
+     *
+     * @param g The input graph
+     * @param colors Reference to store the number of colors used
+     * @return int* Color of every vertex (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static int* smallestLast(const Graph& g, int& colors);
+
+    /**
+     * @brief Parallel greedy coloring in Jones-Plassmann rounds
+     *
+     * Every vertex gets a pseudo-random priority derived from seed. In each
+     * round, all vertices whose higher-priority neighbors are colored are
+     * colored together; they are pairwise non-adjacent, so the rounds run in
+     * parallel when built with OpenMP (-fopenmp). The result equals the
+     * sequential greedy coloring in priority order and does not depend on
+     * the number of threads.
+     *
+     * @param g The input graph
+     * @param colors Reference to store the number of colors used
+     * @param seed Seed of the vertex priorities
+     * @return int* Color of every vertex (must be deleted by caller)
+     *
+     * @complexity Work: O(V + E), Depth: O(log V / log log V) rounds expected
+     *             on bounded-degree graphs, Space: O(T * D + V + E) for T threads
+     */
+    static int* jonesPlassmann(const Graph& g, int& colors, unsigned int seed = 1);
+
+    /**
+     * @brief Parallel speculative greedy coloring (Gebremedhin-Manne)
+     *
+     * All uncolored vertices are colored at once, in parallel when built
+     * with OpenMP (-fopenmp), reading their neighbors' current colors
+     * without synchronization. Adjacent vertices colored concurrently may
+     * pick the same color; of each such pair the vertex with the larger ID
+     * is recolored in the next round, until no conflict is left. Usually
+     * needs fewer colors than jonesPlassmann() and very few rounds, but the
+     * result depends on thread scheduling. Single-threaded it equals greedy
+     * coloring in ID order.
+     *
+     * @param g The input graph
+     * @param colors Reference to store the number of colors used
+     * @return int* Color of every vertex (must be deleted by caller)
+     *
+     * @complexity Work: O(V + E) per round, Space: O(T * D + V + E) for T threads
+     */
+    static int* speculative(const Graph& g, int& colors);
+
+    /**
+     * @brief Maximal independent set, greedy in ID order
+     *
+     * Vertices are visited by increasing ID and join the set unless a
+     * neighbor already did. The set is the lexicographically first maximal
+     * independent set, and equals color 0 of a greedy coloring in ID order.
+     *
+     * @param g The input graph
+     * @param size Reference to store the number of vertices in the set
+     * @return bool* Per-vertex flags, true for members (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static bool* maximalIndependentSet(const Graph& g, int& size);
+
+    /**
+     * @brief Maximal independent set by parallel random-priority (Luby) rounds
+     *
+     * Vertices get the same pseudo-random priorities as jonesPlassmann().
+     * In each round, every undecided vertex whose undecided neighbors all
+     * have lower priority joins the set, and the neighbors of new members
+     * are removed. Rounds run in parallel when built with OpenMP (-fopenmp),
+     * with the joined/decided state of the vertices kept in two bitmaps.
+     * The result is the greedy set in priority order, i.e. color 0 of
+     * jonesPlassmann() with the same seed, for any number of threads.
+     *
+     * @param g The input graph
+     * @param size Reference to store the number of vertices in the set
+     * @param seed Seed of the vertex priorities
+     * @return bool* Per-vertex flags, true for members (must be deleted by caller)
+     *
+     * @complexity Work: O(V + E) per round over the undecided vertices,
+     *             Depth: O(log V) rounds with high probability, Space: O(V + E)
+     */
+    static bool* maximalIndependentSetParallel(const Graph& g, int& size, unsigned int seed = 1);
+
+    /**
+     * @brief Check that a coloring is proper
+     *
+     * @param g The input graph
+     * @param color Color of every vertex
+     * @return true if no edge other than a self-loop joins two vertices of the same color
+     *
+     * @complexity Time: O(V + E), Space: O(D)
+     */
+    static bool isProper(const Graph& g, const int* color);
+};
+
+} // namespace graph
+
+#endif
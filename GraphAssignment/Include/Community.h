@@ -0,0 +1,106 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef COMMUNITY_H
+#define COMMUNITY_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class for community detection (Louvain / Leiden, label propagation)
+ *
+ * Partitions are returned as a dynamically allocated array of
+ * getVertexCount() community numbers, from 0 to (communities - 1), that
+ * must be deleted by the caller.
+ *
+ * Modularity with resolution gamma is
+ * Q = sum over communities c of in(c) / 2m - gamma * (tot(c) / 2m)^2,
+ * where 2m is the total edge weight counted at both endpoints, in(c) the
+ * weight of the edges inside c counted the same way, and tot(c) the sum of
+ * the weighted degrees in c. Edge weights must not be negative.
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated and form their own communities
+ * @note No STL containers are used in this implementation
+ */
+class Community {
+public:
+    /**
+     * @brief Modularity of a given partition
+     *
+     * @param g The input graph
+     * @param community Community number of every vertex, in [0, getVertexCount())
+     * @param resolution Resolution gamma (1 for standard modularity)
+     * @return double The modularity, 0 for a graph without edges
+     * @throws GraphException if a community number is out of range or a weight is negative
+     *
+     * @complexity Time: O(V + E), Space: O(V)
+     */
+    static double modularity(const Graph& g, const int* community, double resolution = 1.0);
+
+    /**
+     * @brief Louvain community detection, optionally with Leiden refinement
+     *
+     * Each level moves vertices to the neighboring community with the
+     * largest modularity gain until the gain of a pass becomes negligible,
+     * then aggregates every community into one vertex of a smaller weighted
+     * graph and repeats on it. Local moving runs in parallel when built with
+     * OpenMP (-fopenmp): threads update vertices in place and community
+     * totals atomically, so the result may vary with the thread count.
+     *
+     * With refinement, each community found by local moving is split into
+     * connected subcommunities by greedily merging singleton vertices into
+     * neighboring subcommunities of the same community (Leiden), and those
+     * are aggregated instead, with the communities as the starting partition
+     * of the next level. This avoids the badly connected communities Louvain
+     * can produce, at the cost of more levels.
+     *
+     * @param g The input graph (weights must not be negative)
+     * @param communities Reference to store the number of communities
+     * @param modularity Reference to store the modularity of the result
+     * @param refine Whether to apply the Leiden refinement
+     * @param resolution Resolution gamma (> 0); larger values give smaller communities
+     * @return int* Community number of every vertex (must be deleted by caller)
+     * @throws GraphException if a weight is negative or resolution <= 0
+     *
+     * @complexity Time: O(E) per pass, typically O(E log V) overall, Space: O(T * V + E) for T threads
+     */
+    static int* louvain(const Graph& g, int& communities, double& modularity,
+                        bool refine = false, double resolution = 1.0);
+
+    /**
+     * @brief Label propagation clustering
+     *
+     * Every vertex starts with its own label and repeatedly takes the label
+     * with the largest total edge weight among its neighbors. A vertex keeps
+     * its current label whenever that label is among the tied best; other
+     * ties are broken by a hash of the vertex and the label, a fixed but
+     * pseudo-random order that differs per vertex, so ties do not all drift
+     * toward the smallest label.
+     * Updates are asynchronous and in place, so later vertices already see
+     * the new labels of earlier ones; when built with OpenMP (-fopenmp) the
+     * vertices of an iteration are shared among threads that read each
+     * other's updates as they happen. Only the neighbors of vertices that
+     * changed their label are revisited in the next iteration, and the
+     * algorithm stops when no label changes or after maxIterations.
+     *
+     * Much faster than louvain(), at the price of lower modularity and a
+     * result that depends on the update order (and thread count).
+     *
+     * @param g The input graph (weights must not be negative)
+     * @param communities Reference to store the number of communities
+     * @param maxIterations Upper bound on the number of iterations (>= 0)
+     * @return int* Community number of every vertex (must be deleted by caller)
+     * @throws GraphException if a weight is negative or maxIterations < 0
+     *
+     * @complexity Time: O(T * V + E) once, then per iteration O(sum of the degrees
+     *             of the active vertices), Space: O(T * V + E) for T threads
+     */
+    static int* labelPropagation(const Graph& g, int& communities, int maxIterations = 100);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,189 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef COMPRESSED_GRAPH_H
+#define COMPRESSED_GRAPH_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Read-only, compressed snapshot of a Graph
+ *
+ * Stores every adjacency list sorted by neighbor ID in one byte array using
+ * variable-length integers (7 bits per byte). Each vertex record holds its
+ * degree, the first neighbor as a signed offset from the vertex itself, the
+ * remaining neighbors as gaps from the previous one, and the edge weights.
+ * When every edge weight is 1 the weights are not stored at all.
+ *
+ * Small IDs and gaps take a single byte, so a graph whose vertices were
+ * relabeled for locality (see Reordering) typically needs 1-2 bytes per
+ * half-edge instead of a full Graph::Node. Integral weights are stored as
+ * zigzag varints and floating-point weights as raw bytes.
+ *
+ * @note Removed (tombstoned) vertex IDs of the source graph become isolated vertices
+ * @note No STL containers are used in this implementation
+ */
+class CompressedGraph {
+public:
+    /**
+     * @brief Build a compressed snapshot of a graph
+     *
+     * @param g The graph to compress
+     *
+     * @complexity Time: O(V + E log D) with D the maximum degree, Space: O(V + D)
+     *             beyond the compressed output
+     */
+    explicit CompressedGraph(const Graph& g);
+
+    /**
+     * @brief Build a compressed graph directly from an array of undirected edges
+     *
+     * Encodes straight into the byte stream without building a Graph first:
+     * the half-edges are bucketed by endpoint into one array of
+     * 2 * count neighbors (half the size of the Graph nodes they replace),
+     * each vertex's run is sorted and encoded. The result is identical to
+     * compressing a Graph built from the same edges (each edge is listed at
+     * both endpoints, a self-loop twice at its vertex).
+     *
+     * @param vertices Number of vertices
+     * @param edges Array of (src, dest, weight) triples
+     * @param count Number of triples in the array (may exceed INT_MAX)
+     * @throws GraphException if vertices or count is negative, any vertex
+     *         index is invalid, or a vertex would have more than INT_MAX
+     *         neighbors
+     *
+     * @complexity Time: O(V + E log D) with D the maximum degree,
+     *             Space: O(V + E) beyond the compressed output
+     */
+    CompressedGraph(int vertices, const Edge* edges, long long count);
+
+    /**
+     * @brief Destroy the CompressedGraph object and free allocated memory
+     */
+    ~CompressedGraph();
+
+    /**
+     * @brief Copying is disabled, as for Graph
+     */
+    CompressedGraph(const CompressedGraph&) = delete;
+
+    /**
+     * @brief Copy assignment is disabled, as for Graph
+     */
+    CompressedGraph& operator=(const CompressedGraph&) = delete;
+
+    /**
+     * @brief Move constructor - take over another compressed graph's storage
+     *
+     * Steals the offset table and encoded data in O(1). The moved-from
+     * graph is left as a valid empty graph with zero vertices.
+     *
+     * @param other The graph to move from
+     */
+    CompressedGraph(CompressedGraph&& other);
+
+    /**
+     * @brief Move assignment - release own storage and take over another's
+     *
+     * @param other The graph to move from (left as an empty graph)
+     * @return CompressedGraph& Reference to this graph
+     */
+    CompressedGraph& operator=(CompressedGraph&& other);
+
+    /**
+     * @brief Get the number of vertices in the graph
+     *
+     * @return int The total number of vertices
+     */
+    int getVertexCount() const;
+
+    /**
+     * @brief Get the number of neighbors of a vertex
+     *
+     * @param vertex The vertex to query (0-based index)
+     * @return int Number of neighbors (a self-loop counts twice)
+     * @throws GraphException if vertex is an invalid index
+     *
+     * @complexity Time: O(1), Space: O(1)
+     */
+    int getDegree(int vertex) const;
+
+    /**
+     * @brief Get the largest degree of any vertex
+     *
+     * @return int The maximum degree
+     */
+    int getMaxDegree() const;
+
+    /**
+     * @brief Get all neighbors of a specific vertex
+     *
+     * Same contract as Graph::getNeighbors(); neighbors are returned in
+     * increasing order of vertex ID.
+     *
+     * @param vertex The vertex whose neighbors to retrieve (0-based index)
+     * @param count Reference to store the number of neighbors found
+     * @return Neighbor* Dynamically allocated array of neighbors (must be deleted by caller)
+     * @throws GraphException if vertex is an invalid index
+     */
+    Neighbor* getNeighbors(int vertex, int& count) const;
+
+    /**
+     * @brief Decode the neighbors of a vertex into a caller-provided buffer
+     *
+     * Same contract as Graph::copyNeighbors(); neighbors are written in
+     * increasing order of vertex ID.
+     *
+     * @param vertex The vertex whose neighbors to decode (0-based index)
+     * @param out Buffer with room for at least getDegree(vertex) entries
+     * @return int The number of neighbors written
+     * @throws GraphException if vertex is an invalid index
+     *
+     * @complexity Time: O(deg(vertex)), Space: O(1)
+     */
+    int copyNeighbors(int vertex, Neighbor* out) const;
+
+    /**
+     * @brief Check whether edge weights were elided because all of them are 1
+     *
+     * @return true if no weights are stored
+     */
+    bool hasUnitWeights() const;
+
+    /**
+     * @brief Get the memory used by the compressed representation
+     *
+     * @return long long Size in bytes of the encoded data and the offset table
+     *         (0 for a moved-from graph)
+     */
+    long long getByteSize() const;
+
+private:
+    int numVertices;          ///< Total number of vertices
+    int maxDegree;            ///< Largest degree of any vertex
+    bool unitWeights;         ///< True if weights are omitted (all equal to 1)
+    long long* offsets;       ///< Start of each vertex record in data (numVertices + 1 entries)
+    unsigned char* data;      ///< Encoded vertex records
+
+    /**
+     * @brief Validate a vertex index
+     *
+     * @param vertex The vertex index to check
+     * @throws GraphException if vertex is out of bounds
+     */
+    void checkVertex(int vertex) const;
+
+    /**
+     * @brief Take over the storage of another graph, leaving it empty
+     *
+     * @param other The graph to take from
+     */
+    void takeFrom(CompressedGraph& other);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,120 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef CONNECTIVITY_H
+#define CONNECTIVITY_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class for bridges, articulation points and biconnected components
+ *
+ * A bridge is an edge whose removal disconnects its endpoints, an
+ * articulation point a vertex whose removal increases the number of
+ * connected components, and a biconnected component a maximal set of edges
+ * in which every two edges lie on a common simple cycle.
+ *
+ * The sequential functions use the Hopcroft-Tarjan low-link DFS with an
+ * explicit stack, so their memory use does not depend on the call stack and
+ * they handle arbitrarily deep graphs. The parallel functions use the
+ * Tarjan-Vishkin method instead: a BFS spanning forest, subtree intervals of
+ * a preorder numbering, and a connectivity pass over the tree edges. All
+ * their phases run in parallel when built with OpenMP (-fopenmp).
+ *
+ * Parallel edges count as separate edges (two copies of an edge are never
+ * bridges) and self-loops are ignored.
+ *
+ * @note Removed (tombstoned) vertex IDs are treated as isolated vertices
+ * @note No STL containers are used in this implementation
+ */
+class Connectivity {
+public:
+    /**
+     * @brief Find all bridges
+     *
+     * @param g The input graph
+     * @param count Reference to store the number of bridges
+     * @return Edge* Bridges with src < dest (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static Edge* bridges(const Graph& g, int& count);
+
+    /**
+     * @brief Find all articulation points
+     *
+     * @param g The input graph
+     * @return bool* Per-vertex flags, true for articulation points (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static bool* articulationPoints(const Graph& g);
+
+    /**
+     * @brief Partition the edges into biconnected components
+     *
+     * Every edge except self-loops is listed once, with src < dest, in
+     * 'edges', and component[i] is the component of edges[i]. Components are
+     * numbered from 0 in the order the DFS closes them, and the edges of each
+     * component are adjacent in the output.
+     *
+     * @param g The input graph
+     * @param edges Set to the edge array (must be deleted by caller)
+     * @param component Set to the per-edge component numbers (must be deleted by caller)
+     * @param edgeCount Reference to store the number of edges
+     * @return int The number of biconnected components
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static int biconnectedComponents(const Graph& g, Edge*& edges, int*& component, int& edgeCount);
+
+    /**
+     * @brief Find all bridges with the parallel spanning-tree method
+     *
+     * Same result as bridges(), in unspecified order. A tree edge is a
+     * bridge when no non-tree edge leaves the subtree below it.
+     *
+     * @param g The input graph
+     * @param count Reference to store the number of bridges
+     * @return Edge* Bridges with src < dest (must be deleted by caller)
+     *
+     * @complexity Work: O(V + E), Depth: O(diameter) levels, Space: O(V + E)
+     */
+    static Edge* bridgesParallel(const Graph& g, int& count);
+
+    /**
+     * @brief Find all articulation points with the parallel Tarjan-Vishkin method
+     *
+     * Same result as articulationPoints(): a vertex is an articulation point
+     * if its edges belong to at least two biconnected components.
+     *
+     * @param g The input graph
+     * @return bool* Per-vertex flags, true for articulation points (must be deleted by caller)
+     *
+     * @complexity Work: O((V + E) alpha(V)), Depth: O(diameter) levels, Space: O(V + E)
+     */
+    static bool* articulationPointsParallel(const Graph& g);
+
+    /**
+     * @brief Partition the edges into biconnected components with the parallel Tarjan-Vishkin method
+     *
+     * Same partition as biconnectedComponents(), but components are numbered
+     * in an unspecified order and edges are listed by increasing src.
+     *
+     * @param g The input graph
+     * @param edges Set to the edge array (must be deleted by caller)
+     * @param component Set to the per-edge component numbers (must be deleted by caller)
+     * @param edgeCount Reference to store the number of edges
+     * @return int The number of biconnected components
+     *
+     * @complexity Work: O((V + E) alpha(V)), Depth: O(diameter) levels, Space: O(V + E)
+     */
+    static int biconnectedComponentsParallel(const Graph& g, Edge*& edges, int*& component, int& edgeCount);
+};
+
+} // namespace graph
+
+#endif
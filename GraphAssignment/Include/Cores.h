@@ -0,0 +1,84 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef CORES_H
+#define CORES_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class for k-core decomposition
+ *
+ * The k-core of a graph is its largest subgraph in which every vertex has at
+ * least k neighbors; the core number of a vertex is the largest k for which
+ * it belongs to the k-core. Core numbers are computed by repeatedly removing
+ * ("peeling") a vertex of minimum remaining degree.
+ *
+ * Degrees are taken from the adjacency lists: parallel edges count once per
+ * copy and self-loops are ignored.
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated and get core number 0
+ * @note No STL containers are used in this implementation
+ */
+class Cores {
+public:
+    /**
+     * @brief Compute the core number of every vertex (Batagelj-Zaversnik)
+     *
+     * Vertices are kept in an array sorted by current degree with the start
+     * of each degree bucket recorded, so removing the minimum-degree vertex
+     * and decrementing a neighbor's degree are both O(1) swaps.
+     *
+     * @param g The input graph
+     * @return int* Array of getVertexCount() core numbers (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V + D) with D the maximum degree
+     */
+    static int* coreNumbers(const Graph& g);
+
+    /**
+     * @brief Compute the core number of every vertex by level-synchronous peeling
+     *
+     * For k = 0, 1, ... all vertices of remaining degree k are removed
+     * together, and the neighbors whose degree drops to k join the next
+     * round of the same level. Each round processes its vertices in parallel
+     * with atomic degree updates when built with OpenMP (-fopenmp); the
+     * result is identical to coreNumbers().
+     *
+     * @param g The input graph
+     * @return int* Array of getVertexCount() core numbers (must be deleted by caller)
+     *
+     * @complexity Time: O(K * V + E) work with K the largest core number, Space: O(V)
+     */
+    static int* coreNumbersParallel(const Graph& g);
+
+    /**
+     * @brief Get the degeneracy of the graph (its largest core number)
+     *
+     * @param g The input graph
+     * @return int The largest k for which the k-core is non-empty (0 for an edgeless graph)
+     *
+     * @complexity Time: O(V + E), Space: O(V + D)
+     */
+    static int degeneracy(const Graph& g);
+
+    /**
+     * @brief Extract the k-core of a graph
+     *
+     * @param g The input graph
+     * @param k The core order (must be >= 0)
+     * @return Graph Graph with the same vertex IDs containing the edges whose
+     *         endpoints both have core number >= k; other vertices are isolated
+     * @throws GraphException if k is negative
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    static Graph kCore(const Graph& g, int k);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,259 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef DIRECTED_GRAPH_H
+#define DIRECTED_GRAPH_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Directed weighted graph stored as CSR (out-edges) and CSC (in-edges)
+ *
+ * Every edge (src, dest, weight) is stored once in the out-adjacency of src
+ * and once in the in-adjacency of dest. Both adjacencies are compressed
+ * sparse arrays: an offset table of V + 1 entries and one contiguous array
+ * of neighbor IDs (and weights), so iterating over the out- or in-neighbors
+ * of a vertex is a sequential scan.
+ *
+ * Out-neighbors are sorted by destination and in-neighbors by source, which
+ * allows hasEdge() to binary search. When every weight is 1 (always in
+ * GRAPH_UNWEIGHTED builds) the weight arrays are not allocated.
+ *
+ * The graph is built in one step from an edge array and is read-only
+ * afterwards. The traversal interface (getVertexCount, getDegree,
+ * getMaxDegree, getNeighbors, copyNeighbors) follows out-edges, so
+ * Algorithms work on it as on Graph; the In variants follow edges backwards.
+ *
+ * @note Self-loops and parallel edges are kept as given
+ * @note No STL containers are used in this implementation
+ */
+class DirectedGraph {
+public:
+    /**
+     * @brief Construct a directed graph with no edges
+     *
+     * @param vertices The number of vertices (must be >= 0)
+     * @throws GraphException if vertices < 0
+     */
+    explicit DirectedGraph(int vertices);
+
+    /**
+     * @brief Construct a directed graph from an array of edges
+     *
+     * Each Edge is interpreted as the arc src -> dest. All edges are
+     * validated before anything is allocated.
+     *
+     * @param vertices The number of vertices (must be >= 0)
+     * @param edges Array of (src, dest, weight) triples
+     * @param count Number of triples in the array
+     * @throws GraphException if vertices or count is negative or any vertex index is invalid
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    DirectedGraph(int vertices, const Edge* edges, int count);
+
+    /**
+     * @brief Destroy the DirectedGraph object and free allocated memory
+     */
+    ~DirectedGraph();
+
+    /**
+     * @brief Copying is disabled, as for Graph
+     */
+    DirectedGraph(const DirectedGraph&) = delete;
+
+    /**
+     * @brief Copy assignment is disabled, as for Graph
+     */
+    DirectedGraph& operator=(const DirectedGraph&) = delete;
+
+    /**
+     * @brief Move constructor - take over another graph's arrays
+     *
+     * @param other The graph to move from (left as an empty graph with zero vertices)
+     */
+    DirectedGraph(DirectedGraph&& other);
+
+    /**
+     * @brief Move assignment - release own arrays and take over another's
+     *
+     * @param other The graph to move from (left as an empty graph with zero vertices)
+     * @return DirectedGraph& Reference to this graph
+     */
+    DirectedGraph& operator=(DirectedGraph&& other);
+
+    /**
+     * @brief Get the number of vertices in the graph
+     *
+     * @return int The total number of vertices
+     */
+    int getVertexCount() const;
+
+    /**
+     * @brief Get the number of directed edges in the graph
+     *
+     * @return int The total number of edges
+     */
+    int getEdgeCount() const;
+
+    /**
+     * @brief Get the out-degree of a vertex
+     *
+     * @param vertex The vertex to query (0-based index)
+     * @return int Number of edges leaving the vertex
+     * @throws GraphException if vertex is an invalid index
+     *
+     * @complexity Time: O(1), Space: O(1)
+     */
+    int getDegree(int vertex) const;
+
+    /**
+     * @brief Get the in-degree of a vertex
+     *
+     * @param vertex The vertex to query (0-based index)
+     * @return int Number of edges entering the vertex
+     * @throws GraphException if vertex is an invalid index
+     *
+     * @complexity Time: O(1), Space: O(1)
+     */
+    int getInDegree(int vertex) const;
+
+    /**
+     * @brief Get the largest out-degree of any vertex
+     *
+     * @return int The maximum out-degree
+     */
+    int getMaxDegree() const;
+
+    /**
+     * @brief Get the largest in-degree of any vertex
+     *
+     * @return int The maximum in-degree
+     */
+    int getMaxInDegree() const;
+
+    /**
+     * @brief Get the out-neighbors of a vertex
+     *
+     * Same contract as Graph::getNeighbors(); neighbors are returned in
+     * increasing order of vertex ID.
+     *
+     * @param vertex The vertex whose out-neighbors to retrieve (0-based index)
+     * @param count Reference to store the number of neighbors found
+     * @return Neighbor* Dynamically allocated array of neighbors (must be deleted by caller)
+     * @throws GraphException if vertex is an invalid index
+     */
+    Neighbor* getNeighbors(int vertex, int& count) const;
+
+    /**
+     * @brief Copy the out-neighbors of a vertex into a caller-provided buffer
+     *
+     * @param vertex The vertex whose out-neighbors to copy (0-based index)
+     * @param out Buffer with room for at least getDegree(vertex) entries
+     * @return int The number of neighbors written
+     * @throws GraphException if vertex is an invalid index
+     *
+     * @complexity Time: O(out-degree), Space: O(1)
+     */
+    int copyNeighbors(int vertex, Neighbor* out) const;
+
+    /**
+     * @brief Get the in-neighbors of a vertex
+     *
+     * Each returned Neighbor is the source of an edge entering the vertex,
+     * with that edge's weight, in increasing order of vertex ID.
+     *
+     * @param vertex The vertex whose in-neighbors to retrieve (0-based index)
+     * @param count Reference to store the number of neighbors found
+     * @return Neighbor* Dynamically allocated array of neighbors (must be deleted by caller)
+     * @throws GraphException if vertex is an invalid index
+     */
+    Neighbor* getInNeighbors(int vertex, int& count) const;
+
+    /**
+     * @brief Copy the in-neighbors of a vertex into a caller-provided buffer
+     *
+     * @param vertex The vertex whose in-neighbors to copy (0-based index)
+     * @param out Buffer with room for at least getInDegree(vertex) entries
+     * @return int The number of neighbors written
+     * @throws GraphException if vertex is an invalid index
+     *
+     * @complexity Time: O(in-degree), Space: O(1)
+     */
+    int copyInNeighbors(int vertex, Neighbor* out) const;
+
+    /**
+     * @brief Check whether the edge src -> dest exists
+     *
+     * @param src Source vertex (0-based index)
+     * @param dest Destination vertex (0-based index)
+     * @return true if at least one edge src -> dest exists
+     * @throws GraphException if src or dest are invalid vertex indices
+     *
+     * @complexity Time: O(log out-degree), Space: O(1)
+     */
+    bool hasEdge(int src, int dest) const;
+
+    /**
+     * @brief Get the weight of the edge src -> dest
+     *
+     * @param src Source vertex (0-based index)
+     * @param dest Destination vertex (0-based index)
+     * @return Weight The weight of the edge (the smallest one among parallel edges)
+     * @throws GraphException if either index is invalid or the edge does not exist
+     *
+     * @complexity Time: O(log out-degree), Space: O(1)
+     */
+    Weight edgeWeight(int src, int dest) const;
+
+    /**
+     * @brief Check whether every edge has weight 1
+     *
+     * @return true if no weights are stored
+     */
+    bool isUnweighted() const;
+
+    /**
+     * @brief Print the out-adjacency of every vertex
+     */
+    void print_graph() const;
+
+private:
+    int numVertices;          ///< Total number of vertices
+    int numEdges;             ///< Total number of directed edges
+    int maxOutDegree;         ///< Largest out-degree
+    int maxInDegree;          ///< Largest in-degree
+    int* outOffsets;          ///< CSR row starts (numVertices + 1 entries)
+    int* outTargets;          ///< Destinations, sorted within each row
+    Weight* outWeights;       ///< Weights parallel to outTargets (nullptr if all are 1)
+    int* inOffsets;           ///< CSC column starts (numVertices + 1 entries)
+    int* inSources;           ///< Sources, sorted within each column
+    Weight* inWeights;        ///< Weights parallel to inSources (nullptr if all are 1)
+
+    /**
+     * @brief Validate a vertex index
+     *
+     * @param vertex The vertex index to check
+     * @throws GraphException if vertex is out of bounds
+     */
+    void checkVertex(int vertex) const;
+
+    /**
+     * @brief Free all arrays and reset to an empty graph
+     */
+    void release();
+
+    /**
+     * @brief Take over the arrays of another graph and reset it to empty
+     *
+     * @param other The graph to take from
+     */
+    void takeFrom(DirectedGraph& other);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,151 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef DISTANCE_MATRIX_H
+#define DISTANCE_MATRIX_H
+
+#include "GraphTypes.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Dense all-pairs distance matrix
+ *
+ * Stores the n x n distances row-major in one contiguous array, so row u
+ * holds the distances from u and the whole matrix can be handed to other
+ * code or written to disk as a single block. Pairs without a path hold
+ * unreachable(), a large value chosen so that the sum of two such values
+ * still fits in Distance.
+ *
+ * The file format written by save() is a 4-byte tag "GDM1", the vertex
+ * count and sizeof(Distance) as 4-byte ints, then the n * n distances, all
+ * in the byte order of the writing machine.
+ *
+ * @note No STL containers are used in this implementation
+ */
+class DistanceMatrix {
+public:
+    /**
+     * @brief Create an n x n matrix with every pair unreachable
+     *
+     * @param n Number of vertices (>= 0)
+     * @throws GraphException if n is negative
+     *
+     * @complexity Time: O(n^2), Space: O(n^2)
+     */
+    explicit DistanceMatrix(int n);
+
+    /**
+     * @brief Destroy the matrix and free its storage
+     */
+    ~DistanceMatrix();
+
+    /**
+     * @brief Copying is disabled, as for Graph
+     */
+    DistanceMatrix(const DistanceMatrix&) = delete;
+
+    /**
+     * @brief Copy assignment is disabled, as for Graph
+     */
+    DistanceMatrix& operator=(const DistanceMatrix&) = delete;
+
+    /**
+     * @brief Move constructor - take over another matrix's storage in O(1)
+     *
+     * @param other The matrix to move from (left as an empty 0 x 0 matrix)
+     */
+    DistanceMatrix(DistanceMatrix&& other);
+
+    /**
+     * @brief Move assignment - release own storage and take over another's
+     *
+     * @param other The matrix to move from (left as an empty 0 x 0 matrix)
+     * @return DistanceMatrix& Reference to this matrix
+     */
+    DistanceMatrix& operator=(DistanceMatrix&& other);
+
+    /**
+     * @brief Number of vertices (rows and columns)
+     */
+    int getVertexCount() const { return n; }
+
+    /**
+     * @brief Distance from one vertex to another
+     *
+     * @param from Source vertex
+     * @param to Target vertex
+     * @return Distance The distance, or unreachable() if there is no path
+     * @throws GraphException if a vertex is out of bounds
+     *
+     * @complexity Time: O(1), Space: O(1)
+     */
+    Distance getDistance(int from, int to) const;
+
+    /**
+     * @brief Whether there is a path from one vertex to another
+     *
+     * @throws GraphException if a vertex is out of bounds
+     */
+    bool isReachable(int from, int to) const;
+
+    /**
+     * @brief Set the distance of one pair
+     *
+     * @throws GraphException if a vertex is out of bounds
+     */
+    void setDistance(int from, int to, Distance d);
+
+    /**
+     * @brief Row of distances from a vertex (getVertexCount() entries)
+     *
+     * @throws GraphException if the vertex is out of bounds
+     */
+    const Distance* row(int from) const;
+
+    /**
+     * @brief Whole matrix, row-major (getVertexCount()^2 entries)
+     */
+    Distance* data() { return values; }
+    const Distance* data() const { return values; }
+
+    /**
+     * @brief Value stored for pairs without a path
+     *
+     * Returns UNREACHABLE_DISTANCE from GraphTypes.h.
+     */
+    static constexpr Distance unreachable() { return UNREACHABLE_DISTANCE; }
+
+    /**
+     * @brief Write the matrix to a binary file
+     *
+     * @param path File to create or overwrite
+     * @throws GraphException if the file cannot be written
+     *
+     * @complexity Time: O(n^2), Space: O(1)
+     */
+    void save(const char* path) const;
+
+    /**
+     * @brief Read a matrix written by save()
+     *
+     * @param path File to read
+     * @return DistanceMatrix The stored matrix
+     * @throws GraphException if the file cannot be read, is not a distance
+     *         matrix, or was written with another Distance type size
+     *
+     * @complexity Time: O(n^2), Space: O(n^2)
+     */
+    static DistanceMatrix load(const char* path);
+
+private:
+    int n;             ///< Number of vertices
+    Distance* values;  ///< n * n distances, row-major
+
+    void checkVertex(int v) const;
+};
+
+} // namespace graph
+
+#endif
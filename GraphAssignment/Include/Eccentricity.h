@@ -0,0 +1,118 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef ECCENTRICITY_H
+#define ECCENTRICITY_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class for eccentricities and the diameter
+ *
+ * The eccentricity of a vertex is its largest distance to a vertex in the
+ * same connected component, and the diameter the largest eccentricity.
+ * Disconnected graphs are handled per component (unreachable pairs are
+ * ignored) and isolated vertices have eccentricity 0.
+ *
+ * The unweighted functions count edges (BFS) and the weighted ones add up
+ * edge weights (Dijkstra), which must not be negative. Instead of a search
+ * from every vertex, the bounds of a few searches rule most vertices out:
+ * the diameter uses iFUB and the eccentricities the bounding method of
+ * Takes and Kosters, both usually needing a handful of searches.
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated vertices
+ * @note No STL containers are used in this implementation
+ */
+class Eccentricity {
+public:
+    /**
+     * @brief Exact diameter in edges by iFUB (iterative fringe upper bound)
+     *
+     * In every component, a double sweep (a search from the highest-degree
+     * vertex, then one from the farthest vertex found) gives a lower bound
+     * and a path; its middle vertex or the highest-degree vertex, whichever
+     * has the smaller eccentricity, becomes the root r. Vertices are then
+     * searched by decreasing distance from r: once all vertices farther than
+     * t have been searched, any remaining pair is at most 2t apart, so the
+     * search stops as soon as the best eccentricity found reaches 2t.
+     * Vertices whose upper bound from earlier searches cannot beat the best
+     * eccentricity are skipped.
+     *
+     * @param g The input graph
+     * @return int The largest eccentricity, 0 for a graph without edges
+     *
+     * @complexity Time: O(k (V + E)) for k searches, k = V in the worst case, Space: O(V + E)
+     */
+    static int diameter(const Graph& g);
+
+    /**
+     * @brief Exact weighted diameter by iFUB with Dijkstra searches
+     *
+     * Same method as diameter(), with distances summed over edge weights.
+     *
+     * @param g The input graph (weights must not be negative)
+     * @return Distance The largest weighted eccentricity
+     * @throws GraphException if a weight is negative
+     *
+     * @complexity Time: O(k (V + E) log V) for k searches, Space: O(V + E)
+     */
+    static Distance weightedDiameter(const Graph& g);
+
+    /**
+     * @brief Lower and upper bounds on every eccentricity from a limited number of searches
+     *
+     * A search from v with eccentricity e gives every vertex w of its
+     * component max(d(v, w), e - d(v, w)) <= ecc(w) <= e + d(v, w). Sources
+     * are picked alternately as the unresolved vertex with the largest
+     * upper and the smallest lower bound, until every eccentricity is
+     * resolved (lower == upper) or 'searches' searches have run. Upper
+     * bounds start at V - 1.
+     *
+     * @param g The input graph
+     * @param searches Maximum number of BFS runs (>= 0)
+     * @param lower Set to the lower bounds (must be deleted by caller)
+     * @param upper Set to the upper bounds (must be deleted by caller)
+     * @return int The number of searches performed
+     * @throws GraphException if searches < 0
+     *
+     * @complexity Time: O(searches (V + E)), Space: O(V + E)
+     */
+    static int eccentricityBounds(const Graph& g, int searches, int*& lower, int*& upper);
+
+    /**
+     * @brief Weighted eccentricity bounds from a limited number of Dijkstra searches
+     *
+     * Same method as eccentricityBounds(); upper bounds start at the total
+     * edge weight.
+     *
+     * @param g The input graph (weights must not be negative)
+     * @param searches Maximum number of Dijkstra runs (>= 0)
+     * @param lower Set to the lower bounds (must be deleted by caller)
+     * @param upper Set to the upper bounds (must be deleted by caller)
+     * @return int The number of searches performed
+     * @throws GraphException if searches < 0 or a weight is negative
+     *
+     * @complexity Time: O(searches (V + E) log V), Space: O(V + E)
+     */
+    static int weightedEccentricityBounds(const Graph& g, int searches,
+                                          Distance*& lower, Distance*& upper);
+
+    /**
+     * @brief Exact eccentricity of every vertex in edges
+     *
+     * eccentricityBounds() run until every vertex is resolved.
+     *
+     * @param g The input graph
+     * @return int* Array of getVertexCount() eccentricities (must be deleted by caller)
+     *
+     * @complexity Time: O(k (V + E)) for k searches, k = V in the worst case, Space: O(V + E)
+     */
+    static int* eccentricities(const Graph& g);
+};
+
+} // namespace graph
+
+#endif
@@ -5,6 +5,7 @@
 #define GRAPH_H
 
 #include "GraphException.h"
+#include "GraphTypes.h"
 
 namespace graph {
 
@@ -16,17 +17,32 @@ namespace graph {
  */
 struct Neighbor {
     int vertex;  ///< The neighbor vertex ID
-    int weight;  ///< The weight of the edge to this neighbor
+    Weight weight;  ///< The weight of the edge to this neighbor
+};
+
+/**
+ * @brief Structure to describe a single edge for batch insertion
+ * 
+ * Used by Graph::addEdges() to pass many (src, dest, weight) triples
+ * in one call instead of calling addEdge() once per edge.
+ */
+struct Edge {
+    int src;     ///< Source vertex ID
+    int dest;    ///< Destination vertex ID
+    Weight weight;  ///< The weight of the edge
 };
 
 /**
  * @brief Graph class implementing an undirected weighted graph using adjacency lists
  * 
  * This class provides a complete implementation of an undirected weighted graph
- * using adjacency lists for efficient storage and traversal. The number of vertices
- * is fixed at construction time and cannot be changed afterward.
+ * using adjacency lists for efficient storage and traversal. The initial number
+ * of vertices is set at construction time; vertices can later be added and
+ * removed, with removed IDs recycled by subsequent insertions.
  * 
  * @note The graph uses 0-based vertex indexing
+ * @note Removed vertex IDs stay in the ID range as isolated vertices until
+ *       they are reused or compact() renumbers the graph
  * @note All edges are undirected (bidirectional)
  * @note STL containers are not used in this implementation
  */
@@ -35,8 +51,8 @@ public:
     /**
      * @brief Construct a new Graph object with a fixed number of vertices
      * 
-     * @param vertices The number of vertices in the graph (must be > 0)
-     * @throws GraphException if vertices <= 0
+     * @param vertices The initial number of vertices in the graph (must be >= 0)
+     * @throws GraphException if vertices < 0
      */
     Graph(int vertices);
 
@@ -48,6 +64,52 @@ public:
      */
     ~Graph();
 
+    /**
+     * @brief Copying is disabled; use clone() for an explicit deep copy
+     * 
+     * The graph owns its adjacency storage through raw pointers, so an
+     * implicit member-wise copy would free the same memory twice.
+     */
+    Graph(const Graph&) = delete;
+
+    /**
+     * @brief Copy assignment is disabled; use clone() for an explicit deep copy
+     */
+    Graph& operator=(const Graph&) = delete;
+
+    /**
+     * @brief Move constructor - take over another graph's storage
+     * 
+     * Steals the adjacency lists, node pool and per-vertex arrays of 'other'
+     * in O(1). The moved-from graph is left as a valid empty graph with zero
+     * vertices.
+     * 
+     * @param other The graph to move from
+     */
+    Graph(Graph&& other);
+
+    /**
+     * @brief Move assignment - release own storage and take over another's
+     * 
+     * @param other The graph to move from (left as an empty graph)
+     * @return Graph& Reference to this graph
+     */
+    Graph& operator=(Graph&& other);
+
+    /**
+     * @brief Create an explicit deep copy of the graph
+     * 
+     * The copy has the same vertex IDs (including removed IDs and the
+     * free-ID stack), the same edges in the same adjacency order, and the
+     * edge index enabled if it is enabled here. All adjacency nodes of the
+     * copy are allocated in one contiguous block, laid out vertex by vertex.
+     * 
+     * @return Graph An independent copy of this graph
+     * 
+     * @complexity Time: O(V + E), Space: O(V + E)
+     */
+    Graph clone() const;
+
     /**
      * @brief Add an undirected edge between two vertices
      * 
@@ -56,10 +118,38 @@ public:
      * 
      * @param src Source vertex (0-based index)
      * @param dest Destination vertex (0-based index)  
-     * @param weight Weight of the edge (default: 1)
+     * @param weight Weight of the edge (default: 1, ignored in GRAPH_UNWEIGHTED builds)
      * @throws GraphException if src or dest are invalid vertex indices
      */
-    void addEdge(int src, int dest, int weight = 1);
+    void addEdge(int src, int dest, Weight weight = 1);
+
+    /**
+     * @brief Add a batch of undirected edges in a single call
+     * 
+     * All edges are validated before the graph is modified, so an invalid
+     * triple leaves the graph unchanged. The degree contributed by the batch
+     * is counted up front and the new adjacency nodes are taken from one
+     * contiguous run of the node pool, laid out so that each vertex's new
+     * edges are adjacent in memory.
+     * 
+     * @param edges Array of (src, dest, weight) triples
+     * @param count Number of triples in the array
+     * @throws GraphException if count is negative or any vertex index is invalid
+     * 
+     * @complexity Time: O(V + count), Space: O(V + count)
+     */
+    void addEdges(const Edge* edges, int count);
+
+    /**
+     * @brief Reserve node storage for a number of upcoming edges
+     * 
+     * Pre-sizes the internal node pool so that the next 'count' calls to
+     * addEdge() do not need to allocate memory.
+     * 
+     * @param count Number of undirected edges to reserve room for
+     * @throws GraphException if count is negative
+     */
+    void reserveEdges(int count);
 
     /**
      * @brief Remove an undirected edge between two vertices
@@ -71,9 +161,140 @@ public:
      * @param dest Destination vertex (0-based index)
      * @throws GraphException if src or dest are invalid vertex indices
      * @throws GraphException if the edge does not exist
+     * 
+     * @complexity Time: O(1) expected with the edge index enabled, O(deg) otherwise
      */
     void removeEdge(int src, int dest);
 
+    /**
+     * @brief Check whether an edge exists between two vertices
+     * 
+     * @param src Source vertex (0-based index)
+     * @param dest Destination vertex (0-based index)
+     * @return true if at least one edge connects src and dest
+     * @throws GraphException if src or dest are invalid vertex indices
+     * 
+     * @complexity Time: O(1) expected with the edge index enabled, O(deg) otherwise
+     */
+    bool hasEdge(int src, int dest) const;
+
+    /**
+     * @brief Get the weight of the edge between two vertices
+     * 
+     * @param src Source vertex (0-based index)
+     * @param dest Destination vertex (0-based index)
+     * @return Weight The weight of the edge
+     * @throws GraphException if src or dest are invalid vertex indices
+     * @throws GraphException if the edge does not exist
+     * 
+     * @complexity Time: O(1) expected with the edge index enabled, O(deg) otherwise
+     * @note If parallel edges exist, the weight of one of them is returned
+     */
+    Weight edgeWeight(int src, int dest) const;
+
+    /**
+     * @brief Change the weight of the edge between two vertices
+     * 
+     * Both directions of the undirected edge are updated.
+     * 
+     * @param src Source vertex (0-based index)
+     * @param dest Destination vertex (0-based index)
+     * @param weight The new edge weight
+     * @throws GraphException if src or dest are invalid vertex indices
+     * @throws GraphException if the edge does not exist
+     * 
+     * @complexity Time: O(1) expected with the edge index enabled, O(deg) otherwise
+     * @note If parallel edges exist, only one of them is updated
+     * @note In GRAPH_UNWEIGHTED builds the weight is ignored
+     */
+    void updateWeight(int src, int dest, Weight weight);
+
+    /**
+     * @brief Check whether every edge of the graph has weight 1
+     * 
+     * Maintained incrementally, so algorithms can switch to unweighted
+     * methods (e.g. BFS instead of Dijkstra) without scanning the edges.
+     * Always true in GRAPH_UNWEIGHTED builds.
+     * 
+     * @return true if no edge has a weight other than 1
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    bool isUnweighted() const;
+
+    /**
+     * @brief Enable the per-vertex edge index
+     * 
+     * Builds a hash table from neighbor ID to adjacency node for every vertex
+     * whose degree reaches INDEX_MIN_DEGREE, and keeps these tables up to date
+     * on later insertions and removals. Low-degree vertices keep using a
+     * linear scan, which is faster than hashing for short lists.
+     * 
+     * @complexity Time: O(V + E), Space: O(E)
+     */
+    void enableEdgeIndex();
+
+    /**
+     * @brief Disable the per-vertex edge index and free its memory
+     */
+    void disableEdgeIndex();
+
+    /**
+     * @brief Check whether the per-vertex edge index is enabled
+     * 
+     * @return true if enableEdgeIndex() is in effect
+     */
+    bool isEdgeIndexEnabled() const;
+
+    /**
+     * @brief Add a new isolated vertex to the graph
+     * 
+     * Reuses the most recently removed vertex ID if one is available;
+     * otherwise appends a new ID, growing the per-vertex storage
+     * geometrically so that repeated insertions are amortized O(1).
+     * 
+     * @return int The ID of the new vertex
+     * 
+     * @complexity Amortized time: O(1)
+     */
+    int addVertex();
+
+    /**
+     * @brief Remove a vertex and all of its incident edges
+     * 
+     * The vertex ID is tombstoned and placed on a free list for reuse by
+     * addVertex(). Until then it behaves as an isolated vertex for read
+     * operations, while adding edges to it throws.
+     * 
+     * @param vertex The vertex to remove (0-based index)
+     * @throws GraphException if vertex is invalid or already removed
+     * 
+     * @complexity Time: O(deg(vertex)) with the edge index enabled on its neighbors
+     */
+    void removeVertex(int vertex);
+
+    /**
+     * @brief Check whether a vertex ID refers to a live (not removed) vertex
+     * 
+     * @param vertex The vertex ID to check
+     * @return true if the ID is in range and has not been removed
+     */
+    bool hasVertex(int vertex) const;
+
+    /**
+     * @brief Renumber the live vertices densely as 0..k-1
+     * 
+     * Removes all tombstoned IDs, preserving the relative order of live
+     * vertices, and releases unused per-vertex storage.
+     * 
+     * @return int* Mapping from old ID to new ID (-1 for removed vertices),
+     *         with one entry per old ID (must be deleted by caller)
+     * 
+     * @complexity Time: O(V + E), Space: O(V)
+     * @note The returned array must be freed using delete[] by the caller
+     */
+    int* compact();
+
     /**
      * @brief Print the graph's adjacency list representation
      * 
@@ -85,10 +306,31 @@ public:
     /**
      * @brief Get the number of vertices in the graph
      * 
+     * This is the size of the vertex ID range, including removed IDs that
+     * have not been reused yet, so it can be used to size per-vertex arrays.
+     * 
      * @return int The total number of vertices
      */
     int getVertexCount() const;
 
+    /**
+     * @brief Get the number of live (not removed) vertices
+     * 
+     * @return int The number of live vertices
+     */
+    int getActiveVertexCount() const;
+
+    /**
+     * @brief Get the number of adjacency entries of a vertex
+     * 
+     * @param vertex The vertex to query (0-based index)
+     * @return int Number of neighbors (a self-loop counts twice)
+     * @throws GraphException if vertex is an invalid index
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    int getDegree(int vertex) const;
+
     /**
      * @brief Get all neighbors of a specific vertex
      * 
@@ -104,37 +346,251 @@ public:
      */
     Neighbor* getNeighbors(int vertex, int& count) const;
 
+    /**
+     * @brief Copy the neighbors of a vertex into a caller-provided buffer
+     * 
+     * Allocation-free alternative to getNeighbors() for traversal loops: the
+     * caller allocates one buffer of getMaxDegree() entries and reuses it.
+     * 
+     * @param vertex The vertex whose neighbors to retrieve (0-based index)
+     * @param out Buffer with room for at least getDegree(vertex) entries
+     * @return int The number of neighbors written
+     * @throws GraphException if vertex is an invalid index
+     */
+    int copyNeighbors(int vertex, Neighbor* out) const;
+
+    /**
+     * @brief Get the largest degree of any vertex
+     * 
+     * @return int The maximum degree (0 for a graph without edges)
+     * 
+     * @complexity Time: O(V), Space: O(1)
+     */
+    int getMaxDegree() const;
+
 private:
     /**
      * @brief Internal node structure for the adjacency list
      * 
      * Each node represents an edge in the adjacency list, containing
-     * the destination vertex, edge weight, and pointer to the next node.
+     * the destination vertex, edge weight, and the pool indices of the
+     * neighboring nodes. The list is doubly linked so that a node located
+     * through the edge index can be unlinked in O(1). Links are 32-bit pool
+     * indices rather than pointers, so a node takes 16 bytes with an int
+     * weight; GRAPH_UNWEIGHTED builds omit the weight field (12 bytes).
      */
     struct Node {
         int vertex;   ///< Destination vertex
-        int weight;   ///< Edge weight
-        Node* next;   ///< Pointer to next node in the list
+#ifndef GRAPH_UNWEIGHTED
+        Weight weight;   ///< Edge weight
+#endif
+        int next;     ///< Pool index of the next node in the list (NO_NODE at the tail)
+        int prev;     ///< Pool index of the previous node in the list (NO_NODE at the head)
+    };
+    static_assert(sizeof(Weight) > sizeof(int) || sizeof(Node) <= 4 * sizeof(int),
+                  "Adjacency nodes must stay at four 32-bit words");
+
+    /// Pool index marking the end of a list or an empty slot
+    static const int NO_NODE = -1;
+
+    /**
+     * @brief Read the weight of a node (always 1 in GRAPH_UNWEIGHTED builds)
+     */
+    static Weight nodeWeight(const Node* node) {
+#ifdef GRAPH_UNWEIGHTED
+        (void)node;
+        return 1;
+#else
+        return node->weight;
+#endif
+    }
+
+    /**
+     * @brief Store the weight of a node (no-op in GRAPH_UNWEIGHTED builds)
+     */
+    static void setNodeWeight(Node* node, Weight weight) {
+#ifdef GRAPH_UNWEIGHTED
+        (void)node;
+        (void)weight;
+#else
+        node->weight = weight;
+#endif
+    }
+
+    /**
+     * @brief Open-addressing hash table over one vertex's adjacency nodes
+     * 
+     * Slots hold node pool indices keyed by the node's vertex field, using linear
+     * probing with a power-of-two capacity. Parallel edges occupy separate slots.
+     */
+    struct EdgeIndex {
+        int* slots;     ///< Slot array (NO_NODE marks an empty slot)
+        int capacity;   ///< Number of slots (power of two)
+        int size;       ///< Number of occupied slots
     };
 
-    int numVertices;        ///< Total number of vertices in the graph
-    Node** adjacencyList;   ///< Array of pointers to adjacency lists
+    /// Minimum degree at which a vertex gets its own hash table
+    static const int INDEX_MIN_DEGREE = 16;
+
+    int numVertices;        ///< Size of the vertex ID range
+    int vertexCapacity;     ///< Allocated length of the per-vertex arrays
+    int activeVertices;     ///< Number of live vertices
+    bool* removed;          ///< Tombstone flag per vertex ID
+    int* freeIds;           ///< Stack of removed IDs available for reuse
+    int freeIdCount;        ///< Number of IDs on the freeIds stack
+    int* adjacencyList;     ///< Pool index of the first node of each list (NO_NODE if empty)
+    Node* nodes;            ///< Node pool: one contiguous array addressed by index
+    int nodeCapacity;       ///< Allocated length of the node pool
+    int nodeCount;          ///< Number of pool nodes handed out so far
+    int freeNodes;          ///< Head of the list of released nodes (NO_NODE if none)
+    int* degree;            ///< Number of adjacency entries per vertex
+    int nonUnitNodes;       ///< Number of adjacency nodes with weight other than 1
+    EdgeIndex** edgeIndex;  ///< Per-vertex hash tables (nullptr when disabled)
 
     /**
      * @brief Create a new node for the adjacency list
      * 
      * @param vertex The vertex this node points to
      * @param weight The weight of the edge
-     * @return Node* Pointer to the newly created node
+     * @return int Pool index of the newly created node
+     */
+    int createNode(int vertex, Weight weight);
+
+    /**
+     * @brief Return a node to the pool so it can be reused
+     * 
+     * @param node Pool index of the node to release
+     */
+    void releaseNode(int node);
+
+    /**
+     * @brief Grow the node pool so that 'extra' more nodes fit after nodeCount
+     * 
+     * Links are indices, so the pool can be moved to a larger array.
+     * 
+     * @param extra Number of nodes that must fit
+     * @throws GraphException if the pool would exceed INT_MAX nodes
+     */
+    void reserveNodes(int extra);
+
+    /**
+     * @brief Free all storage owned by the graph
+     * 
+     * Shared by the destructor and move assignment.
+     */
+    void release();
+
+    /**
+     * @brief Take over the storage of another graph and reset it to empty
+     * 
+     * @param other The graph whose storage is taken
+     */
+    void takeFrom(Graph& other);
+
+    /**
+     * @brief Validate a vertex index
+     * 
+     * @param vertex The vertex index to check
+     * @throws GraphException if vertex is out of bounds
+     */
+    void checkVertex(int vertex) const;
+
+    /**
+     * @brief Validate a vertex index and make sure it has not been removed
+     * 
+     * @param vertex The vertex index to check
+     * @throws GraphException if vertex is out of bounds or removed
+     */
+    void checkActiveVertex(int vertex) const;
+
+    /**
+     * @brief Reallocate all per-vertex arrays with a new capacity
+     * 
+     * Entries beyond the current ID range are initialized as empty.
+     * 
+     * @param capacity The new capacity (must be >= numVertices)
+     */
+    void resizeVertexStorage(int capacity);
+
+    /**
+     * @brief Insert a node at the head of a vertex's adjacency list
+     * 
+     * Updates the degree and, when enabled, the vertex's edge index.
+     * 
+     * @param owner Vertex whose list receives the node
+     * @param node Pool index of the node to insert
+     */
+    void linkNode(int owner, int node);
+
+    /**
+     * @brief Remove a node from a vertex's adjacency list and release it
+     * 
+     * @param owner Vertex whose list contains the node
+     * @param node Pool index of the node to remove
+     */
+    void unlinkNode(int owner, int node);
+
+    /**
+     * @brief Locate an adjacency node of 'owner' pointing to 'target'
+     * 
+     * Uses the edge index when the owner has one, otherwise scans the list.
+     * When matchWeight is set, a node with the given weight is preferred so
+     * that both halves of the same parallel edge are found together.
+     * 
+     * @param owner Vertex whose list is searched
+     * @param target Neighbor vertex to look for
+     * @param weight Preferred weight when matchWeight is true
+     * @param matchWeight Whether to prefer nodes with the given weight
+     * @param skip Node to ignore (used for the second half of a self-loop)
+     * @return int Pool index of the node found, or NO_NODE if there is none
+     */
+    int findNode(int owner, int target, Weight weight = 0, bool matchWeight = false,
+                 int skip = NO_NODE) const;
+
+    /**
+     * @brief Find the second half of an undirected edge
+     * 
+     * @param src Vertex owning the first half
+     * @param dest Vertex owning the second half
+     * @param half The first half, already located in src's list
+     * @return int The matching node in dest's list, or NO_NODE
+     */
+    int findTwin(int src, int dest, int half) const;
+
+    /**
+     * @brief Locate one half of an edge, searching from whichever endpoint
+     *        is cheaper (indexed, or otherwise lower degree)
+     * 
+     * @param src First endpoint
+     * @param dest Second endpoint
+     * @return int A node of the edge, or NO_NODE if it does not exist
+     */
+    int locateEdge(int src, int dest) const;
+
+    /**
+     * @brief Build the hash table of a single vertex from its adjacency list
+     * 
+     * @param owner The vertex to index
+     */
+    void buildIndex(int owner);
+
+    /**
+     * @brief Add consecutive list nodes to their owner's hash table, creating
+     *        the table when the owner's degree reaches INDEX_MIN_DEGREE
+     * 
+     * @param owner Vertex whose list contains the nodes
+     * @param first First node to index (already linked into the list)
+     * @param count Number of nodes to index, following next links
      */
-    Node* createNode(int vertex, int weight);
+    void indexInsert(int owner, int first, int count);
 
     /**
-     * @brief Delete a linked list starting from the given head
+     * @brief Remove a node from its owner's hash table, if it has one
      * 
-     * @param head Pointer to the head of the list to delete
+     * @param owner Vertex whose list contains the node
+     * @param node The node to remove from the index
      */
-    void deleteList(Node* head);
+    void indexErase(int owner, int node);
 };
 
 } // namespace graph
@@ -0,0 +1,83 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef GRAPH_TYPES_H
+#define GRAPH_TYPES_H
+
+/**
+ * @file GraphTypes.h
+ * @brief Compile-time selection of the edge weight and path distance types
+ *
+ * The whole library is built for one weight type and one distance type,
+ * chosen with preprocessor definitions (e.g. via the Makefile's DEFS):
+ *
+ * - GRAPH_WEIGHT_TYPE   (default int): type stored on every edge, e.g.
+ *   unsigned char or uint8_t for compact weights, long long or double for
+ *   wide ones
+ * - GRAPH_DISTANCE_TYPE (default long long): type used to accumulate path
+ *   lengths and as priority in PriorityQueue; it must be able to represent
+ *   every weight and the longest path (use double with floating weights)
+ *
+ * Accumulating distances in a wider type than the weights avoids the
+ * overflow of summing many int weights into an int.
+ *
+ * Defining GRAPH_UNWEIGHTED builds the unweighted variant: adjacency nodes
+ * store only neighbor IDs, every edge has weight 1 (weight arguments are
+ * ignored), and Algorithms::dijkstra is answered by BFS. Weight is still
+ * defined so that Neighbor and Edge keep the same layout for callers.
+ *
+ * @note Vertex IDs remain int throughout the library
+ */
+
+#include <cstdint>  // So fixed-width names such as uint8_t can be chosen
+
+#ifndef GRAPH_WEIGHT_TYPE
+#define GRAPH_WEIGHT_TYPE int
+#endif
+
+#ifndef GRAPH_DISTANCE_TYPE
+#define GRAPH_DISTANCE_TYPE long long
+#endif
+
+namespace graph {
+
+typedef GRAPH_WEIGHT_TYPE Weight;      ///< Type of an edge weight
+typedef GRAPH_DISTANCE_TYPE Distance;  ///< Type of a path length
+
+// 2^exponent by repeated doubling, exact for integer and floating Distance types
+constexpr Distance distancePower(unsigned exponent) {
+    return exponent == 0 ? Distance(1) : static_cast<Distance>(2 * distancePower(exponent - 1));
+}
+
+/**
+ * Distance stored for pairs without a path: 2^(b - 3) for a b-bit Distance,
+ * e.g. 2^61 for long long, so the sum of two such values still fits. Real
+ * distances must stay below half of it in absolute value.
+ */
+constexpr Distance UNREACHABLE_DISTANCE = distancePower(8 * sizeof(Distance) - 3);
+
+// Sign test selected at compile time, so unsigned types never compare against 0
+template<typename T, bool Signed>
+struct SignTest {
+    static constexpr bool negative(T value) { return value < T(0); }
+};
+
+template<typename T>
+struct SignTest<T, false> {
+    static constexpr bool negative(T) { return false; }
+};
+
+/**
+ * @brief Whether a weight or distance is below zero
+ *
+ * Constant false when the type (Weight or Distance) is unsigned, so sign
+ * checks compile without always-false comparison warnings.
+ */
+template<typename T>
+constexpr bool isNegative(T value) {
+    return SignTest<T, (T(-1) < T(0))>::negative(value);
+}
+
+} // namespace graph
+
+#endif
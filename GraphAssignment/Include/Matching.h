@@ -0,0 +1,89 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef MATCHING_H
+#define MATCHING_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class for bipartite graphs and their matchings
+ *
+ * A matching is returned as a dynamically allocated mate array of
+ * getVertexCount() entries, mate[v] being the vertex matched to v or -1,
+ * that must be deleted by the caller. The two sides of the graph are
+ * found by bipartition(); isolated vertices are put on the first side.
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated and stay unmatched
+ * @note No STL containers are used in this implementation
+ */
+class Matching {
+public:
+    /**
+     * @brief Check whether the graph is bipartite (2-colorable)
+     *
+     * @param g The input graph
+     * @return true if no edge joins two vertices of the same side
+     *
+     * @complexity Time: O(V + E), Space: O(V)
+     */
+    static bool isBipartite(const Graph& g);
+
+    /**
+     * @brief Split the vertices into two sides with no edge inside a side
+     *
+     * BFS 2-coloring of every connected component; the vertex with the
+     * smallest ID of each component is on the first side.
+     *
+     * @param g The input graph
+     * @return bool* Per-vertex flags, true on the second side (must be deleted by caller)
+     * @throws GraphException if the graph is not bipartite (odd cycle or self-loop)
+     *
+     * @complexity Time: O(V + E), Space: O(V)
+     */
+    static bool* bipartition(const Graph& g);
+
+    /**
+     * @brief Maximum-cardinality matching of a bipartite graph (Hopcroft-Karp)
+     *
+     * Starting from a Karp-Sipser greedy matching (vertices with a single
+     * unmatched neighbor first), each phase finds the length of the
+     * shortest augmenting paths with a BFS from all free vertices of the
+     * first side, then augments along a maximal set of vertex-disjoint
+     * shortest paths with an iterative DFS over the BFS layers.
+     *
+     * @param g The input graph (must be bipartite)
+     * @param size Reference to store the number of matched pairs
+     * @return int* The mate array (must be deleted by caller)
+     * @throws GraphException if the graph is not bipartite
+     *
+     * @complexity Time: O(E sqrt(V)), Space: O(V + E)
+     */
+    static int* maximumMatching(const Graph& g, int& size);
+
+    /**
+     * @brief Minimum-weight maximum-cardinality matching (assignment problem)
+     *
+     * Among the matchings of maximum size, finds one of minimum total edge
+     * weight by successive shortest augmenting paths: Dijkstra over reduced
+     * weights with vertex potentials, which keeps them non-negative even for
+     * negative edge weights. For a maximum-weight assignment, negate the
+     * weights.
+     *
+     * @param g The input graph (must be bipartite)
+     * @param size Reference to store the number of matched pairs
+     * @param weight Reference to store the total weight of the matching
+     * @return int* The mate array (must be deleted by caller)
+     * @throws GraphException if the graph is not bipartite
+     *
+     * @complexity Time: O(V * E log E), Space: O(V + E)
+     */
+    static int* minWeightAssignment(const Graph& g, int& size, Distance& weight);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,99 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef MAX_FLOW_H
+#define MAX_FLOW_H
+
+#include "Graph.h"
+#include "DirectedGraph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class computing maximum s-t flows and minimum s-t cuts
+ *
+ * Edge weights are the capacities and must not be negative. An undirected
+ * edge of a Graph can carry flow either way up to its weight; a
+ * DirectedGraph edge only from src to dest. Parallel edges add up and
+ * self-loops are ignored.
+ *
+ * The solver is highest-label push-relabel over an arc array in which every
+ * edge is stored as a pair of mutually reverse arcs with residual
+ * capacities. Labels are reset to exact BFS distances to the sink at the
+ * start and after every O(V + E) units of relabeling work (global
+ * relabeling), and when no vertex is left at some label, all vertices above
+ * it are cut off from the sink at once (gap heuristic).
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated
+ * @note No STL containers are used in this implementation
+ */
+class MaxFlow {
+public:
+    /**
+     * @brief Value of a maximum flow from source to sink
+     *
+     * @param g The input graph (weights are capacities, >= 0)
+     * @param source The source vertex
+     * @param sink The sink vertex
+     * @return Distance The maximum flow value
+     * @throws GraphException if a vertex is out of bounds, source == sink,
+     *         or a weight is negative
+     *
+     * @complexity Time: O(V^2 sqrt(E)), Space: O(V + E)
+     */
+    static Distance maxFlow(const Graph& g, int source, int sink);
+
+    /**
+     * @brief Value of a maximum flow from source to sink along directed edges
+     *
+     * @param g The directed input graph (weights are capacities, >= 0)
+     * @param source The source vertex
+     * @param sink The sink vertex
+     * @return Distance The maximum flow value
+     * @throws GraphException if a vertex is out of bounds, source == sink,
+     *         or a weight is negative
+     *
+     * @complexity Time: O(V^2 sqrt(E)), Space: O(V + E)
+     */
+    static Distance maxFlow(const DirectedGraph& g, int source, int sink);
+
+    /**
+     * @brief Minimum s-t cut
+     *
+     * The source side is the set of vertices that cannot reach the sink in
+     * the residual network of a maximum flow; its outgoing capacity equals
+     * the maximum flow value.
+     *
+     * @param g The input graph (weights are capacities, >= 0)
+     * @param source The source vertex
+     * @param sink The sink vertex
+     * @param sourceSide Set to per-vertex flags, true on the source side (must be deleted by caller)
+     * @return Distance The cut capacity (= maximum flow value)
+     * @throws GraphException as maxFlow()
+     *
+     * @complexity Time: O(V^2 sqrt(E)), Space: O(V + E)
+     */
+    static Distance minCut(const Graph& g, int source, int sink, bool*& sourceSide);
+
+    /**
+     * @brief Minimum s-t cut of a directed graph
+     *
+     * Same as minCut(const Graph&, ...), counting the capacity of the edges
+     * from the source side to the sink side.
+     *
+     * @param g The directed input graph (weights are capacities, >= 0)
+     * @param source The source vertex
+     * @param sink The sink vertex
+     * @param sourceSide Set to per-vertex flags, true on the source side (must be deleted by caller)
+     * @return Distance The cut capacity (= maximum flow value)
+     * @throws GraphException as maxFlow()
+     *
+     * @complexity Time: O(V^2 sqrt(E)), Space: O(V + E)
+     */
+    static Distance minCut(const DirectedGraph& g, int source, int sink, bool*& sourceSide);
+};
+
+} // namespace graph
+
+#endif
@@ -0,0 +1,74 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef MIN_CUT_H
+#define MIN_CUT_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class computing global minimum cuts of weighted graphs
+ *
+ * A cut splits the active vertices into two non-empty sides; its value is
+ * the total weight of the edges between the sides. Both functions return
+ * the value of a minimum cut and set 'side' to a dynamically allocated
+ * array of getVertexCount() flags, true for the vertices of one side, that
+ * must be deleted by the caller.
+ *
+ * Edge weights must not be negative. Self-loops never cross a cut and are
+ * ignored; parallel edges add up.
+ *
+ * @note Removed (tombstoned) vertex IDs are on neither side (flag false)
+ * @note No STL containers are used in this implementation
+ */
+class MinCut {
+public:
+    /**
+     * @brief Exact minimum cut (Stoer-Wagner)
+     *
+     * Each phase grows a set from one vertex by repeatedly adding the vertex
+     * most tightly connected to it, taken from an indexed max-heap
+     * PriorityQueue whose keys are increased in place. The last two vertices
+     * s, t of the phase give a candidate cut (t alone against the rest) and
+     * are then merged. After V - 1 phases the best candidate is minimum.
+     *
+     * @param g The input graph (at least 2 active vertices, weights >= 0)
+     * @param side Set to the per-vertex side flags (must be deleted by caller)
+     * @return Distance The minimum cut value
+     * @throws GraphException if fewer than 2 vertices are active or a weight is negative
+     *
+     * @complexity Time: O(V * E log V), Space: O(V + E)
+     */
+    static Distance stoerWagner(const Graph& g, bool*& side);
+
+    /**
+     * @brief Randomized minimum cut (Karger-Stein recursive contraction)
+     *
+     * Contracts random edges, chosen with probability proportional to their
+     * weight, down to V / sqrt(2) + 1 vertices, then recurses twice on the
+     * result and keeps the better cut; graphs of at most 6 vertices are
+     * solved by trying every split. One trial finds a minimum cut with
+     * probability Omega(1 / log V); independent trials run in parallel
+     * when built with OpenMP (-fopenmp), each with a UnionFind for its
+     * contractions.
+     *
+     * @param g The input graph (at least 2 active vertices, weights >= 0)
+     * @param side Set to the per-vertex side flags (must be deleted by caller)
+     * @param trials Number of independent trials; 0 selects ceil(ln(V)^2),
+     *               which fails with probability about 1 / V
+     * @param seed Seed of the pseudo-random contractions
+     * @return Distance The value of the best cut found (a minimum cut with high probability)
+     * @throws GraphException if fewer than 2 vertices are active, a weight is
+     *         negative, or trials < 0
+     *
+     * @complexity Time: O(trials * V^2 log V) for E = O(V^2), Space: O(T * E log V) for T threads
+     */
+    static Distance kargerStein(const Graph& g, bool*& side, int trials = 0, unsigned int seed = 1);
+};
+
+} // namespace graph
+
+#endif
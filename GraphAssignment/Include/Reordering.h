@@ -0,0 +1,118 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef REORDERING_H
+#define REORDERING_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/**
+ * @brief Static class computing vertex relabelings that improve cache locality
+ *
+ * Vertex IDs are used directly as indices into per-vertex arrays (visited flags,
+ * distances, parents), so neighbors with distant IDs cause scattered memory
+ * accesses. This class computes permutations that place related vertices at
+ * nearby IDs, builds the relabeled graph, and maps results back to the
+ * original IDs.
+ *
+ * All permutations use the convention perm[oldId] = newId and are returned as
+ * dynamically allocated arrays of getVertexCount() entries.
+ *
+ * @note Removed (tombstoned) vertex IDs are treated as isolated vertices
+ * @note No STL containers are used in this implementation
+ */
+class Reordering {
+public:
+    /**
+     * @brief Compute a Reverse Cuthill-McKee ordering
+     *
+     * Each connected component is traversed breadth-first from a
+     * pseudo-peripheral vertex, visiting the neighbors of every vertex in
+     * increasing order of degree; the resulting order is then reversed.
+     * This minimizes the bandwidth of the adjacency matrix, keeping
+     * neighbor IDs close to each other.
+     *
+     * @param g The input graph
+     * @return int* Permutation with perm[old] = new (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E log D) with D the maximum degree, Space: O(V)
+     */
+    static int* reverseCuthillMcKee(const Graph& g);
+
+    /**
+     * @brief Compute a degree-descending ordering
+     *
+     * High-degree vertices receive the smallest IDs, so the hot part of
+     * every per-vertex array is packed together. Ties keep the original order.
+     *
+     * @param g The input graph
+     * @return int* Permutation with perm[old] = new (must be deleted by caller)
+     *
+     * @complexity Time: O(V + D) with D the maximum degree, Space: O(V + D)
+     */
+    static int* degreeOrder(const Graph& g);
+
+    /**
+     * @brief Compute a breadth-first ordering
+     *
+     * Vertices are numbered in the order a BFS visits them, starting each
+     * component at its highest-degree vertex. Vertices discovered together
+     * receive consecutive IDs.
+     *
+     * @param g The input graph
+     * @return int* Permutation with perm[old] = new (must be deleted by caller)
+     *
+     * @complexity Time: O(V + E), Space: O(V)
+     */
+    static int* bfsOrder(const Graph& g);
+
+    /**
+     * @brief Build the relabeled graph for a permutation
+     *
+     * Every edge (u, v, w) becomes (perm[u], perm[v], w). The edges are
+     * inserted with Graph::addEdges(), so the adjacency nodes of the result
+     * are laid out contiguously in new-ID order.
+     *
+     * @param g The input graph
+     * @param perm Permutation with perm[old] = new
+     * @return Graph The relabeled graph
+     * @throws GraphException if perm is not a permutation of 0..V-1
+     *
+     * @complexity Time: O(V + E), Space: O(V + E)
+     * @note To map a result graph (e.g. a BFS tree) back, apply inverse(perm)
+     */
+    static Graph apply(const Graph& g, const int* perm);
+
+    /**
+     * @brief Compute the inverse of a permutation
+     *
+     * @param perm Permutation with perm[old] = new
+     * @param n Number of entries
+     * @return int* Inverse permutation with inv[new] = old (must be deleted by caller)
+     * @throws GraphException if perm is not a permutation of 0..n-1
+     */
+    static int* inverse(const int* perm, int n);
+
+    /**
+     * @brief Map a per-vertex result computed on a relabeled graph back to original IDs
+     *
+     * @tparam T Type of the per-vertex values
+     * @param perm Permutation with perm[old] = new used to build the relabeled graph
+     * @param reordered Values indexed by new ID
+     * @param original Output array indexed by original ID
+     * @param n Number of vertices
+     */
+    template<typename T>
+    static void mapBack(const int* perm, const T* reordered, T* original, int n) {
+        for (int v = 0; v < n; ++v) {
+            original[v] = reordered[perm[v]];
+        }
+    }
+};
+
+} // namespace graph
+
+#endif
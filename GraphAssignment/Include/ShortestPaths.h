@@ -0,0 +1,364 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef SHORTEST_PATHS_H
+#define SHORTEST_PATHS_H
+
+#include "Graph.h"
+#include "DirectedGraph.h"
+#include "DistanceMatrix.h"
+#include "GraphException.h"
+
+namespace graph {
+
+struct PathArcs;
+struct ReverseTree;
+struct SpurSearch;
+
+/**
+ * @brief Static class for shortest paths with possibly negative weights
+ *
+ * The single-source functions return an array of distances from the
+ * source, and the all-pairs functions a DistanceMatrix whose entry (u, v)
+ * is the length of a shortest path from u to v; pairs without a path get
+ * DistanceMatrix::unreachable(). Negative weights are allowed as long as
+ * no cycle has negative total weight; an undirected edge is followed both
+ * ways, so a negative undirected edge is itself a negative cycle.
+ * negativeCycle() returns such a cycle when there is one.
+ *
+ * Floyd-Warshall suits dense graphs and Johnson sparse ones. Both, and
+ * the spur searches of kShortestPaths(), run in parallel when built with
+ * OpenMP (-fopenmp).
+ *
+ * @note Removed (tombstoned) vertex IDs are isolated vertices
+ * @note No STL containers are used in this implementation
+ */
+class ShortestPaths {
+public:
+    /**
+     * @brief Single-source shortest paths by Bellman-Ford
+     *
+     * Relaxes every edge leaving a reached vertex in rounds, stopping at
+     * the first round that changes nothing; a change in round V proves a
+     * negative cycle reachable from the source.
+     *
+     * @param g The input graph
+     * @param source The source vertex
+     * @param parent Set to the predecessor of every vertex on its shortest
+     *        path, -1 for the source and unreachable vertices (must be deleted by caller)
+     * @return Distance* Array of getVertexCount() distances (must be deleted by caller)
+     * @throws GraphException if source is invalid or a negative cycle is
+     *         reachable from it
+     *
+     * @complexity Time: O(V E), O(k E) when shortest paths have at most k edges, Space: O(V + E)
+     */
+    static Distance* bellmanFord(const Graph& g, int source, int*& parent);
+
+    /**
+     * @brief Single-source shortest paths by Bellman-Ford on a directed graph
+     *
+     * Same as bellmanFord(const Graph&, ...), following out-edges.
+     *
+     * @param g The directed input graph
+     * @param source The source vertex
+     * @param parent Set to the predecessors (must be deleted by caller)
+     * @return Distance* Array of getVertexCount() distances (must be deleted by caller)
+     * @throws GraphException if source is invalid or a negative cycle is
+     *         reachable from it
+     *
+     * @complexity Time: O(V E), Space: O(V + E)
+     */
+    static Distance* bellmanFord(const DirectedGraph& g, int source, int*& parent);
+
+    /**
+     * @brief Single-source shortest paths by SPFA (queue-based Bellman-Ford)
+     *
+     * Only vertices whose distance dropped are queued and rescanned. Two
+     * heuristics order the queue: a vertex entering with a smaller distance
+     * than the front goes to the front (SLF, small label first), and a front
+     * vertex whose distance is above the queue average is moved to the back
+     * before a vertex is taken (LLL, large label last). A vertex whose path
+     * reaches V edges proves a negative cycle. It usually scans far fewer
+     * arcs than bellmanFord(), with the same worst case, though on graphs
+     * that converge in a few rounds the sequential sweeps of bellmanFord()
+     * can be faster.
+     *
+     * @param g The input graph
+     * @param source The source vertex
+     * @param parent Set to the predecessor of every vertex on its shortest
+     *        path, -1 for the source and unreachable vertices (must be deleted by caller)
+     * @return Distance* Array of getVertexCount() distances (must be deleted by caller)
+     * @throws GraphException if source is invalid or a negative cycle is
+     *         reachable from it
+     *
+     * @complexity Time: O(V E) worst case, Space: O(V + E)
+     */
+    static Distance* spfa(const Graph& g, int source, int*& parent);
+
+    /**
+     * @brief Single-source shortest paths by SPFA on a directed graph
+     *
+     * Same as spfa(const Graph&, ...), following out-edges.
+     *
+     * @param g The directed input graph
+     * @param source The source vertex
+     * @param parent Set to the predecessors (must be deleted by caller)
+     * @return Distance* Array of getVertexCount() distances (must be deleted by caller)
+     * @throws GraphException if source is invalid or a negative cycle is
+     *         reachable from it
+     *
+     * @complexity Time: O(V E) worst case, Space: O(V + E)
+     */
+    static Distance* spfa(const DirectedGraph& g, int source, int*& parent);
+
+    /**
+     * @brief Find a cycle of negative total weight anywhere in the graph
+     *
+     * Bellman-Ford from a virtual source joined to every vertex; the vertex
+     * relaxed in round V leads through its predecessors to a negative cycle.
+     *
+     * @param g The input graph
+     * @param length Set to the number of vertices on the cycle, 0 if there is none
+     * @return int* The cycle's vertices in edge order, the last one leading
+     *         back to the first, or nullptr if there is no negative cycle
+     *         (must be deleted by caller)
+     *
+     * @complexity Time: O(V E), Space: O(V + E)
+     */
+    static int* negativeCycle(const Graph& g, int& length);
+
+    /**
+     * @brief Find a negative cycle in a directed graph
+     *
+     * Same as negativeCycle(const Graph&, ...), following out-edges.
+     *
+     * @param g The directed input graph
+     * @param length Set to the number of vertices on the cycle, 0 if there is none
+     * @return int* The cycle's vertices in edge order, or nullptr (must be deleted by caller)
+     *
+     * @complexity Time: O(V E), Space: O(V + E)
+     */
+    static int* negativeCycle(const DirectedGraph& g, int& length);
+
+    /**
+     * @brief All-pairs shortest paths by blocked Floyd-Warshall
+     *
+     * The matrix is processed in 64 x 64 tiles. For every diagonal tile k,
+     * the tile itself is closed first, then the tiles in its row and
+     * column, then all remaining tiles; the tiles of the last two steps are
+     * independent and are updated in parallel. Each tile update is a
+     * min-plus product whose inner loop runs over contiguous row entries,
+     * so the compiler can vectorize it, and the three tiles involved stay
+     * in cache.
+     *
+     * @param g The input graph
+     * @return DistanceMatrix The distances between all pairs
+     * @throws GraphException if the graph contains a negative cycle
+     *
+     * @complexity Time: O(V^3), Space: O(V^2)
+     */
+    static DistanceMatrix floydWarshall(const Graph& g);
+
+    /**
+     * @brief All-pairs shortest paths by blocked Floyd-Warshall on a directed graph
+     *
+     * Same as floydWarshall(const Graph&), following out-edges.
+     *
+     * @param g The directed input graph
+     * @return DistanceMatrix The distances between all pairs
+     * @throws GraphException if the graph contains a negative cycle
+     *
+     * @complexity Time: O(V^3), Space: O(V^2)
+     */
+    static DistanceMatrix floydWarshall(const DirectedGraph& g);
+
+    /**
+     * @brief All-pairs shortest paths by Johnson's algorithm
+     *
+     * Bellman-Ford from a virtual source joined to every vertex gives
+     * potentials h with w(u, v) + h(u) - h(v) >= 0 on every edge; one
+     * Dijkstra per source over these reduced weights then gives the
+     * distances, shifted back by h. The Dijkstra runs are independent and
+     * run in parallel, one per source. Without negative weights the
+     * Bellman-Ford step is skipped.
+     *
+     * @param g The input graph
+     * @return DistanceMatrix The distances between all pairs
+     * @throws GraphException if the graph contains a negative cycle
+     *
+     * @complexity Time: O(V E log V), Space: O(V^2)
+     */
+    static DistanceMatrix johnson(const Graph& g);
+
+    /**
+     * @brief All-pairs shortest paths by Johnson's algorithm on a directed graph
+     *
+     * Same as johnson(const Graph&), following out-edges.
+     *
+     * @param g The directed input graph
+     * @return DistanceMatrix The distances between all pairs
+     * @throws GraphException if the graph contains a negative cycle
+     *
+     * @complexity Time: O(V E log V), Space: O(V^2)
+     */
+    static DistanceMatrix johnson(const DirectedGraph& g);
+
+    /**
+     * @brief The k shortest loopless paths between two vertices (Yen's algorithm)
+     *
+     * Paths are found in order of length. Each new path is the best
+     * candidate so far, and every candidate is the shortest spur path from a
+     * vertex of the previous path that avoids the root before it and the
+     * continuations of earlier paths with the same root. Only spur vertices
+     * from the point where the previous path left its parent are searched
+     * (Lawler), and the searches of one iteration run in parallel.
+     *
+     * One reverse shortest-path tree to the target is built up front and
+     * reused by every search: its distances are a lower bound for A* on the
+     * restricted graphs, and when the tree path of a spur vertex avoids the
+     * restrictions it is taken without any search. Equal-length paths are
+     * ordered by fewer vertices, then by discovery order, for any thread
+     * count.
+     *
+     * Builds a KShortestPaths query object for this one call; to answer
+     * many queries on the same graph, keep a KShortestPaths instead.
+     *
+     * @param g The input graph (weights must not be negative)
+     * @param source First vertex of every path
+     * @param target Last vertex of every path
+     * @param k Maximum number of paths (>= 0)
+     * @param offsets Set to the path starts: path i is
+     *        vertices[offsets[i] .. offsets[i+1]) (must be deleted by caller)
+     * @param vertices Set to the vertices of all paths, source to target
+     *        (must be deleted by caller)
+     * @param lengths Set to the length of every path (must be deleted by caller)
+     * @return int The number of paths found, less than k if there are no more
+     * @throws GraphException if a vertex is invalid, k < 0 or a weight is negative
+     *
+     * @complexity Time: O(k V (E + V) log V) worst case, Space: O(k V + E)
+     */
+    static int kShortestPaths(const Graph& g, int source, int target, int k,
+                              int*& offsets, int*& vertices, Distance*& lengths);
+
+    /**
+     * @brief The k shortest loopless paths on a directed graph
+     *
+     * Same as kShortestPaths(const Graph&, ...), following out-edges.
+     *
+     * @param g The directed input graph (weights must not be negative)
+     * @param source First vertex of every path
+     * @param target Last vertex of every path
+     * @param k Maximum number of paths (>= 0)
+     * @param offsets Set to the path starts (must be deleted by caller)
+     * @param vertices Set to the vertices of all paths (must be deleted by caller)
+     * @param lengths Set to the length of every path (must be deleted by caller)
+     * @return int The number of paths found
+     * @throws GraphException if a vertex is invalid, k < 0 or a weight is negative
+     *
+     * @complexity Time: O(k V (E + V) log V) worst case, Space: O(k V + E)
+     */
+    static int kShortestPaths(const DirectedGraph& g, int source, int target, int k,
+                              int*& offsets, int*& vertices, Distance*& lengths);
+};
+
+/**
+ * @brief Reusable k shortest loopless path queries on one graph
+ *
+ * Holds what every query on a graph needs: the arc snapshot, the reversed
+ * arcs of a directed graph (an undirected graph uses its own arcs), the
+ * reverse shortest-path tree and one spur search workspace per thread.
+ * They are built once, so a query does not pay O(V + E) of setup.
+ *
+ * Each query runs Yen's algorithm as ShortestPaths::kShortestPaths()
+ * describes, except that the reverse Dijkstra from the target stops as
+ * soon as the source is settled. Every vertex it did not settle is at
+ * least that far from the target, so that radius is their A* lower bound
+ * in the spur searches. Only the vertices labeled by the previous query
+ * are reset. A query therefore costs time in the region it explores,
+ * which for short paths is a small part of the graph.
+ *
+ * The object works on a snapshot: later changes to the graph are not
+ * seen. Queries must not run concurrently on one object (each query
+ * already runs its spur searches in parallel under OpenMP).
+ *
+ * @note No STL containers are used in this implementation
+ */
+class KShortestPaths {
+public:
+    /**
+     * @brief Prepare queries on an undirected graph
+     *
+     * @param g The input graph (weights must not be negative)
+     * @throws GraphException if a weight is negative
+     *
+     * @complexity Time: O(V + E), Space: O(V + E) plus O(V + E) per thread on first use
+     */
+    explicit KShortestPaths(const Graph& g);
+
+    /**
+     * @brief Prepare queries on a directed graph, following out-edges
+     *
+     * @param g The directed input graph (weights must not be negative)
+     * @throws GraphException if a weight is negative
+     *
+     * @complexity Time: O(V + E), Space: O(V + E) plus O(V + E) per thread on first use
+     */
+    explicit KShortestPaths(const DirectedGraph& g);
+
+    /**
+     * @brief Destroy the query object and free its workspaces
+     */
+    ~KShortestPaths();
+
+    /**
+     * @brief Copying is disabled; the workspaces are owned by one object
+     */
+    KShortestPaths(const KShortestPaths&) = delete;
+
+    /**
+     * @brief Copy assignment is disabled
+     */
+    KShortestPaths& operator=(const KShortestPaths&) = delete;
+
+    /**
+     * @brief The k shortest loopless paths between two vertices
+     *
+     * Same results and output arrays as ShortestPaths::kShortestPaths().
+     *
+     * @param source First vertex of every path
+     * @param target Last vertex of every path
+     * @param k Maximum number of paths (>= 0)
+     * @param offsets Set to the path starts: path i is
+     *        vertices[offsets[i] .. offsets[i+1]) (must be deleted by caller)
+     * @param vertices Set to the vertices of all paths, source to target
+     *        (must be deleted by caller)
+     * @param lengths Set to the length of every path (must be deleted by caller)
+     * @return int The number of paths found, less than k if there are no more
+     * @throws GraphException if a vertex is invalid or k < 0
+     *
+     * @complexity Time: O((R + A) log R) for the reverse search, with R the
+     *             vertices within the source's distance of the target and A
+     *             their arcs, plus the spur searches (O(k V (E + V) log V)
+     *             worst case), Space: O(k V) per query
+     */
+    int find(int source, int target, int k, int*& offsets, int*& vertices, Distance*& lengths);
+
+private:
+    int n;                    ///< Number of vertices
+    PathArcs* arcs;           ///< Out-arcs of every vertex
+    PathArcs* reverseArcs;    ///< In-arcs of a directed graph, nullptr when arcs serve both ways
+    ReverseTree* tree;        ///< Shortest-path tree toward the current target
+    SpurSearch** workspaces;  ///< Spur search workspace per thread, created on first use
+    int threads;              ///< Number of workspace slots
+
+    /**
+     * @brief Check the weights and allocate the tree and workspace slots
+     *
+     * @throws GraphException if a weight is negative (arcs are freed first)
+     */
+    void prepare();
+};
+
+} // namespace graph
+
+#endif
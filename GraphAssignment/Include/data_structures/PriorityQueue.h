@@ -4,16 +4,22 @@
 #define PRIORITY_QUEUE_H
 
 #include "../GraphException.h"
+#include "../GraphTypes.h"
 
 /**
- * @brief A min-heap based priority queue implementation
+ * @brief A binary heap based priority queue implementation
  * 
- * This class implements a priority queue using a binary min-heap data structure.
+ * This class implements a priority queue using a binary heap data structure.
  * Elements are stored with associated priorities, and the element with the lowest
  * priority value can be efficiently extracted. This implementation is specifically
  * designed for graph algorithms like Dijkstra's shortest path and Prim's MST.
  * 
- * @note The priority queue uses a min-heap (lowest priority = highest precedence)
+ * A queue can also be built as a max-heap (highest priority first) and as an
+ * indexed heap, in which the values are distinct IDs in [0, capacity) whose
+ * position in the heap is tracked, so that a queued value can be looked up
+ * and its priority changed in place (as needed by Stoer-Wagner's minimum cut).
+ * 
+ * @note The priority queue uses a min-heap by default (lowest priority = highest precedence)
  * @note Fixed capacity set at construction time
  * @note No STL containers are used in this implementation
  */
@@ -32,6 +38,19 @@ public:
      */
     PriorityQueue(int size);
 
+    /**
+     * @brief Construct a Priority Queue with a chosen heap order and indexing
+     * 
+     * @param size The maximum number of elements the priority queue can hold
+     * @param maxHeap If true, the highest priority is extracted first
+     * @param indexed If true, values must be distinct IDs in [0, size) and
+     *        contains() / changePriority() are available
+     * @throws GraphException if size <= 0
+     * 
+     * @complexity Time: O(size) if indexed, O(1) otherwise, Space: O(size)
+     */
+    PriorityQueue(int size, bool maxHeap, bool indexed);
+
     /**
      * @brief Destroy the Priority Queue object and free allocated memory
      * 
@@ -46,13 +65,15 @@ public:
      * The element is positioned in the heap according to its priority (min-heap property).
      * 
      * @param value The value to be inserted
-     * @param priority The priority of the element (lower values = higher precedence)
-     * @throws GraphException if the priority queue is full
+     * @param priority The priority of the element (lower values = higher precedence),
+     *        of the library-wide Distance type so path lengths do not overflow
+     * @throws GraphException if the priority queue is full, or for an indexed
+     *         queue if value is out of range or already queued
      * 
      * @complexity Time: O(log n), Space: O(1)
      * @note Lower priority values have higher precedence (min-heap)
      */
-    void insert(int value, int priority);
+    void insert(int value, graph::Distance priority);
 
     /**
      * @brief Extract and return the element with minimum priority
@@ -67,6 +88,64 @@ public:
      */
     int extractMin();
 
+    /**
+     * @brief Extract and return the element at the top of the heap
+     * 
+     * The element with the lowest priority for a min-heap, the highest for a max-heap.
+     * 
+     * @return int The value of the top element
+     * @throws GraphException if the priority queue is empty
+     * 
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    int extractTop();
+
+    /**
+     * @brief Priority of the element at the top of the heap
+     * 
+     * @return graph::Distance The priority the next extractTop() would return
+     * @throws GraphException if the priority queue is empty
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    graph::Distance topPriority() const;
+
+    /**
+     * @brief Check if a value is queued (indexed queues only)
+     * 
+     * @param value The value to look up
+     * @return true if value is currently in the queue
+     * @throws GraphException if the queue is not indexed
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    bool contains(int value) const;
+
+    /**
+     * @brief Get the priority of a queued value (indexed queues only)
+     * 
+     * @param value A value currently in the queue
+     * @return graph::Distance Its priority
+     * @throws GraphException if the queue is not indexed or value is not queued
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    graph::Distance priorityOf(int value) const;
+
+    /**
+     * @brief Change the priority of a queued value (indexed queues only)
+     * 
+     * The element moves up or down the heap as needed, e.g. a decrease-key
+     * in a min-heap or an increase-key in a max-heap.
+     * 
+     * @param value A value currently in the queue
+     * @param priority Its new priority
+     * @throws GraphException if the queue is not indexed or value is not queued
+     * 
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    void changePriority(int value, graph::Distance priority);
+
     /**
      * @brief Check if the priority queue is empty
      * 
@@ -86,17 +165,34 @@ private:
      */
     struct Element {
         int value;      ///< The actual data value
-        int priority;   ///< Priority of the element (lower = higher precedence)
+        graph::Distance priority;   ///< Priority of the element (lower = higher precedence)
     };
 
-    Element* heap;   ///< Dynamic array representing the min-heap
+    Element* heap;   ///< Dynamic array representing the heap
+    int* position;   ///< Heap index of each value, -1 if not queued (indexed queues only)
     int capacity;    ///< Maximum capacity of the priority queue
     int size;        ///< Current number of elements in the queue
+    bool maxHeap;    ///< Whether the highest priority has the highest precedence
+
+    /**
+     * @brief Whether element i must be above element j in the heap
+     */
+    bool precedes(int i, int j) const;
+
+    /**
+     * @brief Swap two heap slots, keeping the position index up to date
+     */
+    void swapElements(int i, int j);
+
+    /**
+     * @brief Throw unless the queue is indexed and value is queued
+     */
+    void checkQueued(int value) const;
 
     /**
      * @brief Restore min-heap property by moving element up the tree
      * 
-     * Helper method to maintain min-heap property after insertion.
+     * Helper method to maintain the heap property after insertion.
      * Moves element up until heap property is satisfied.
      * 
      * @param i Index of element to heapify up
@@ -106,7 +202,7 @@ private:
     /**
      * @brief Restore min-heap property by moving element down the tree
      * 
-     * Helper method to maintain min-heap property after extraction.
+     * Helper method to maintain the heap property after extraction.
      * Moves element down until heap property is satisfied.
      * 
      * @param i Index of element to heapify down
@@ -12,6 +12,8 @@
  * This class implements a queue data structure with fixed capacity using a circular
  * array approach. It provides standard queue operations (enqueue, dequeue, isEmpty)
  * and is specifically designed for use in graph traversal algorithms like BFS.
+ * enqueueFront() and peek() also let it serve as a double-ended work list,
+ * as in the SLF/LLL variants of SPFA.
  * 
  * @note The queue has a fixed capacity set at construction time
  * @note Uses circular array implementation for efficient space utilization
@@ -63,6 +65,35 @@ public:
      */
     int dequeue();
 
+    /**
+     * @brief Add an element to the front of the queue
+     * 
+     * The element will be the next one returned by dequeue().
+     * 
+     * @param value The integer value to add to the queue
+     * @throws GraphException if the queue is full
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    void enqueueFront(int value);
+
+    /**
+     * @brief Return the front element without removing it
+     * 
+     * @return int The value of the front element
+     * @throws GraphException if the queue is empty
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    int peek() const;
+
+    /**
+     * @brief Number of elements in the queue
+     * 
+     * @complexity Time: O(1), Space: O(1)
+     */
+    int size() const;
+
     /**
      * @brief Check if the queue is empty
      * 
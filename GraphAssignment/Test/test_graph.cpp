@@ -9,19 +9,94 @@
  * - Data structure functionality (Queue, PriorityQueue, UnionFind)
  * - Exception handling and edge cases
  * - Algorithm correctness validation
+ * - Vertex reordering (RCM, degree, BFS order)
+ * - Compressed adjacency storage
+ * - Unweighted graph handling (also run via make test-unweighted)
+ * - Directed graphs (CSR/CSC adjacency, forward and reverse traversals)
+ * - Triangle counting and clustering coefficients
+ * - k-core decomposition (sequential and level-synchronous peeling)
+ * - PageRank (uniform, personalized, weighted, directed)
+ * - Betweenness centrality (exact and sampled)
+ * - Bridges, articulation points and biconnected components (iterative and parallel)
+ * - Global minimum cut (Stoer-Wagner, Karger-Stein) and the indexed max-heap
+ * - Maximum flow and minimum s-t cut (push-relabel)
+ * - Bipartiteness, Hopcroft-Karp matching and minimum-weight assignment
+ * - Louvain / Leiden community detection and modularity
+ * - Label propagation with asynchronous frontier updates
+ * - Vertex coloring (largest-first, smallest-last, Jones-Plassmann, speculative)
+ * - Maximal independent sets (greedy and parallel Luby rounds)
+ * - Diameter (iFUB) and eccentricity bounds, unweighted and weighted
+ * - All-pairs shortest paths (blocked Floyd-Warshall, Johnson) and distance matrix files
+ * - Bellman-Ford, SPFA (SLF/LLL) and negative cycle reporting
+ * - K shortest loopless paths (Yen)
  */
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 #include "../Include/Graph.h"
 #include "../Include/Algorithms.h"
+#include "../Include/Reordering.h"
+#include "../Include/CompressedGraph.h"
+#include "../Include/DirectedGraph.h"
+#include "../Include/Triangles.h"
+#include "../Include/Cores.h"
+#include "../Include/Centrality.h"
+#include "../Include/Connectivity.h"
+#include "../Include/MinCut.h"
+#include "../Include/MaxFlow.h"
+#include "../Include/Matching.h"
+#include "../Include/Community.h"
+#include "../Include/Coloring.h"
+#include "../Include/Eccentricity.h"
+#include "../Include/ShortestPaths.h"
 #include "../Include/GraphException.h"
 #include "../Include/data_structures/Queue.h"
 #include "../Include/data_structures/PriorityQueue.h"
 #include "../Include/data_structures/UnionFind.h"
+#include <cstdio>
 
 using namespace graph;
 
+// Lengths of all simple paths from u to target by DFS, appended to 'lengths'
+template<typename G>
+static void allPathLengths(const G& g, int u, int target, Distance length, bool* onPath,
+                           Distance* lengths, int& count) {
+    if (u == target) {
+        lengths[count++] = length;
+        return;
+    }
+    onPath[u] = true;
+    int degree = 0;
+    Neighbor* neighbors = g.getNeighbors(u, degree);
+    for (int i = 0; i < degree; ++i) {
+        if (!onPath[neighbors[i].vertex]) {
+            allPathLengths(g, neighbors[i].vertex, target, length + neighbors[i].weight, onPath,
+                           lengths, count);
+        }
+    }
+    delete[] neighbors;
+    onPath[u] = false;
+}
+
+// Test cases asserting specific edge weights are skipped in GRAPH_UNWEIGHTED builds
+#ifdef GRAPH_UNWEIGHTED
+#define WEIGHTED_ONLY doctest::skip()
+#else
+#define WEIGHTED_ONLY doctest::skip(false)
+#endif
+
+// Negative weights exist only when Weight is signed (not in GRAPH_WEIGHT_TYPE=unsigned builds)
+static constexpr bool SIGNED_WEIGHTS = isNegative(Weight(-1));
+// Weights near INT_MAX need a Weight of at least 32 bits (not uint8_t or short)
+static constexpr bool WIDE_WEIGHTS = sizeof(Weight) >= 4;
+#ifdef GRAPH_UNWEIGHTED
+#define NEGATIVE_WEIGHTS_ONLY doctest::skip()
+#define WIDE_WEIGHTS_ONLY doctest::skip()
+#else
+#define NEGATIVE_WEIGHTS_ONLY doctest::skip(!SIGNED_WEIGHTS)
+#define WIDE_WEIGHTS_ONLY doctest::skip(!WIDE_WEIGHTS)
+#endif
+
 /**
  * @brief Test case for basic graph operations
  * 
@@ -230,6 +305,42 @@ TEST_CASE("PriorityQueue operations") {
     CHECK_THROWS_AS(pq.insert(999, 999), GraphException);
 }
 
+/**
+ * @brief Test case for the max-heap and indexed PriorityQueue modes
+ * 
+ * Validates:
+ * - Max-heap extraction order and topPriority()
+ * - contains(), priorityOf() and changePriority() in both directions
+ * - Exceptions for duplicate, out-of-range and non-queued values
+ */
+TEST_CASE("Indexed max-heap PriorityQueue") {
+    PriorityQueue pq(5, true, true);
+    pq.insert(0, 5);
+    pq.insert(1, 2);
+    pq.insert(2, 8);
+    pq.insert(3, 1);
+    CHECK(pq.topPriority() == 8);
+    CHECK(pq.contains(3));
+    CHECK(!pq.contains(4));
+
+    pq.changePriority(3, 10);  // Increase to the top
+    pq.changePriority(2, 0);   // Decrease to the bottom
+    CHECK(pq.priorityOf(2) == 0);
+    CHECK(pq.extractTop() == 3);
+    CHECK(!pq.contains(3));
+    CHECK(pq.extractTop() == 0);
+    CHECK(pq.extractTop() == 1);
+    CHECK(pq.extractTop() == 2);
+    CHECK(pq.isEmpty());
+
+    pq.insert(4, 1);
+    CHECK_THROWS_AS(pq.insert(4, 2), GraphException);
+    CHECK_THROWS_AS(pq.insert(5, 2), GraphException);
+    CHECK_THROWS_AS(pq.changePriority(0, 1), GraphException);
+    PriorityQueue plain(5);
+    CHECK_THROWS_AS(plain.contains(0), GraphException);
+}
+
 /**
  * @brief Test case for UnionFind data structure functionality
  * 
@@ -442,3 +553,2313 @@ TEST_CASE("Single vertex and edge cases") {
     CHECK(hasEdgeToOne);  // Should have the single edge in MST
     delete[] neighbors;
 }
+
+/**
+ * @brief Test case for batch edge insertion
+ * 
+ * Validates the addEdges() batch API and reserveEdges() pre-sizing:
+ * - All edges of a batch are visible from both endpoints with their weights
+ * - Batched edges coexist with edges added one by one
+ * - An invalid triple rejects the whole batch without modifying the graph
+ */
+TEST_CASE("Batch edge insertion" * WEIGHTED_ONLY) {
+    Graph g(4);
+    g.reserveEdges(4);
+    g.addEdge(0, 3, 7);
+
+    Edge batch[] = {{0, 1, 2}, {1, 2, 3}, {2, 3, 4}};
+    g.addEdges(batch, 3);
+
+    int count;
+    Neighbor* neighbors = g.getNeighbors(0, count);
+    CHECK(count == 2);
+    int weightTo1 = 0, weightTo3 = 0;
+    for (int i = 0; i < count; ++i) {
+        if (neighbors[i].vertex == 1) weightTo1 = neighbors[i].weight;
+        if (neighbors[i].vertex == 3) weightTo3 = neighbors[i].weight;
+    }
+    delete[] neighbors;
+    CHECK(weightTo1 == 2);
+    CHECK(weightTo3 == 7);
+
+    neighbors = g.getNeighbors(2, count);
+    CHECK(count == 2);  // Vertex 2 is connected to 1 and 3
+    delete[] neighbors;
+
+    // Batch with an out-of-range vertex must not add any of its edges
+    Edge bad[] = {{0, 2, 1}, {1, 9, 1}};
+    CHECK_THROWS_AS(g.addEdges(bad, 2), GraphException);
+    neighbors = g.getNeighbors(0, count);
+    CHECK(count == 2);
+    delete[] neighbors;
+
+    // Removed batch edges are recycled by later insertions
+    g.removeEdge(1, 2);
+    g.addEdge(1, 3, 5);
+    neighbors = g.getNeighbors(1, count);
+    CHECK(count == 2);
+    delete[] neighbors;
+}
+
+/**
+ * @brief Test case for edge lookup and the per-vertex edge index
+ * 
+ * Validates hasEdge(), edgeWeight(), updateWeight() and removeEdge() both
+ * with the linear-scan fallback and with the hash index enabled on a hub:
+ * - Lookups agree before and after enabling the index
+ * - Removal through the index keeps both endpoints consistent
+ * - Parallel edges are removed as matching pairs
+ * - Vertices added after enabling the index can be indexed
+ */
+TEST_CASE("Edge lookup and edge index" * WEIGHTED_ONLY) {
+    const int leaves = 100;
+    Graph g(leaves + 1);
+    for (int v = 1; v <= leaves; ++v) {
+        g.addEdge(0, v, v);  // Hub 0 connected to every leaf
+    }
+
+    CHECK(g.hasEdge(0, 50));
+    CHECK(g.hasEdge(50, 0));
+    CHECK(!g.hasEdge(1, 2));
+    CHECK(g.edgeWeight(0, 42) == 42);
+    CHECK_THROWS_AS(g.edgeWeight(1, 2), GraphException);
+
+    g.enableEdgeIndex();
+    CHECK(g.isEdgeIndexEnabled());
+    CHECK(g.getDegree(0) == leaves);
+
+    // Remove every even leaf through the index
+    for (int v = 2; v <= leaves; v += 2) {
+        g.removeEdge(0, v);
+    }
+    CHECK(g.getDegree(0) == leaves / 2);
+    bool onlyOddLeft = true;
+    for (int v = 1; v <= leaves; ++v) {
+        if (g.hasEdge(0, v) != (v % 2 == 1)) onlyOddLeft = false;
+    }
+    CHECK(onlyOddLeft);
+    CHECK(g.getDegree(2) == 0);
+
+    g.updateWeight(77, 0, 5);
+    CHECK(g.edgeWeight(0, 77) == 5);
+    CHECK(g.edgeWeight(77, 0) == 5);
+
+    // Parallel edges: removing one leaves the other intact on both sides
+    g.addEdge(0, 3, 9);
+    g.removeEdge(3, 0);
+    CHECK(g.hasEdge(0, 3));
+    CHECK(g.edgeWeight(0, 3) == g.edgeWeight(3, 0));
+
+    g.disableEdgeIndex();
+    CHECK(!g.isEdgeIndexEnabled());
+    CHECK(g.hasEdge(0, 99));
+    CHECK_THROWS_AS(g.updateWeight(2, 4, 1), GraphException);
+
+    // Vertices added into spare capacity after enabling the index get
+    // index slots too, including one that grows into a hub
+    Graph grown(0);
+    for (int i = 0; i < 3; ++i) grown.addVertex();  // Capacity 4
+    grown.enableEdgeIndex();
+    int hub = grown.addVertex();
+    for (int i = 0; i < 40; ++i) {
+        int leaf = grown.addVertex();
+        grown.addEdge(hub, leaf, leaf);
+    }
+    grown.addEdge(hub, 0, 2);
+    CHECK(grown.getDegree(hub) == 41);
+    CHECK(grown.hasEdge(hub, 0));
+    CHECK(grown.hasEdge(20, hub));
+    CHECK(grown.edgeWeight(hub, 30) == 30);
+    grown.removeEdge(30, hub);
+    CHECK(!grown.hasEdge(hub, 30));
+}
+
+/**
+ * @brief Test case for dynamic vertex insertion and removal
+ * 
+ * Validates addVertex(), removeVertex() and compact():
+ * - New vertices extend the ID range and can receive edges
+ * - Removing a vertex drops its incident edges and frees its ID for reuse
+ * - Removed vertices reject new edges but read as isolated
+ * - compact() renumbers live vertices densely and preserves edges
+ */
+TEST_CASE("Dynamic vertices" * WEIGHTED_ONLY) {
+    Graph g(0);
+    for (int i = 0; i < 5; ++i) {
+        CHECK(g.addVertex() == i);
+    }
+    g.addEdge(0, 1, 1);
+    g.addEdge(1, 2, 2);
+    g.addEdge(2, 3, 3);
+    g.addEdge(3, 4, 4);
+    g.addEdge(1, 1, 9);  // Self-loop on a vertex that will be removed
+
+    g.removeVertex(1);
+    CHECK(!g.hasVertex(1));
+    CHECK(g.getVertexCount() == 5);
+    CHECK(g.getActiveVertexCount() == 4);
+    CHECK(g.getDegree(0) == 0);
+    CHECK(g.getDegree(2) == 1);
+    CHECK_THROWS_AS(g.addEdge(0, 1), GraphException);
+    CHECK_THROWS_AS(g.removeVertex(1), GraphException);
+
+    int count;
+    Neighbor* neighbors = g.getNeighbors(1, count);
+    CHECK(count == 0);  // Tombstoned IDs read as isolated vertices
+    delete[] neighbors;
+
+    // Algorithms still run over the full ID range
+    Graph tree = Algorithms::bfs(g, 2);
+    CHECK(tree.getVertexCount() == 5);
+
+    g.removeVertex(3);
+    CHECK(g.addVertex() == 3);  // Most recently freed ID is reused first
+    g.addEdge(3, 4, 7);
+
+    int* mapping = g.compact();
+    CHECK(mapping[0] == 0);
+    CHECK(mapping[1] == -1);
+    CHECK(mapping[2] == 1);
+    CHECK(mapping[4] == 3);
+    CHECK(g.getVertexCount() == 4);
+    CHECK(g.getActiveVertexCount() == 4);
+    CHECK(g.edgeWeight(mapping[3], mapping[4]) == 7);
+    CHECK(!g.hasEdge(mapping[2], mapping[3]));  // Removed with old vertex 3
+    delete[] mapping;
+}
+
+/**
+ * @brief Test case for move semantics and explicit cloning
+ * 
+ * Validates that graphs can be moved without copying and cloned explicitly:
+ * - A moved-from graph becomes an empty graph and the target owns the edges
+ * - Move assignment replaces the target's previous contents
+ * - clone() produces an independent deep copy including removed vertex IDs
+ * - A clone of an indexed graph can grow and index new vertices
+ */
+TEST_CASE("Move semantics and clone" * WEIGHTED_ONLY) {
+    Graph g(3);
+    g.addEdge(0, 1, 4);
+    g.addEdge(1, 2, 6);
+
+    Graph moved(static_cast<Graph&&>(g));
+    CHECK(g.getVertexCount() == 0);
+    CHECK(moved.getVertexCount() == 3);
+    CHECK(moved.edgeWeight(1, 2) == 6);
+
+    Graph target(10);
+    target.addEdge(5, 6);
+    target = static_cast<Graph&&>(moved);
+    CHECK(target.getVertexCount() == 3);
+    CHECK(target.edgeWeight(0, 1) == 4);
+    CHECK(moved.getVertexCount() == 0);
+
+    target.removeVertex(2);
+    Graph copy = target.clone();
+    CHECK(copy.getVertexCount() == 3);
+    CHECK(!copy.hasVertex(2));
+    CHECK(copy.edgeWeight(1, 0) == 4);
+
+    // The copy is independent of the original
+    copy.updateWeight(0, 1, 8);
+    copy.addEdge(0, 0);
+    CHECK(target.edgeWeight(0, 1) == 4);
+    CHECK(target.getDegree(0) == 1);
+    CHECK(copy.addVertex() == 2);  // The free-ID stack is cloned too
+
+    // A clone of an indexed graph keeps the index, sized for growth
+    Graph indexed(5);  // Capacity 5, grown to 10 by the next vertex
+    indexed.addVertex();
+    indexed.enableEdgeIndex();
+    Graph indexedCopy = indexed.clone();
+    CHECK(indexedCopy.isEdgeIndexEnabled());
+    int hub = indexedCopy.addVertex();
+    for (int i = 0; i < 30; ++i) {
+        int leaf = indexedCopy.addVertex();
+        indexedCopy.addEdge(leaf, hub, 1);
+    }
+    CHECK(indexedCopy.getDegree(hub) == 30);
+    CHECK(indexedCopy.hasEdge(hub, hub + 30));
+    CHECK(!indexedCopy.hasEdge(hub, 0));
+    CHECK(indexed.getVertexCount() == 6);
+}
+
+/**
+ * @brief Test case for vertex reordering
+ * 
+ * Validates the permutations computed by Reordering and their application:
+ * - Every ordering is a valid permutation
+ * - Reverse Cuthill-McKee turns a scrambled path into a band of width 1
+ * - Degree order puts the highest-degree vertex first
+ * - apply() preserves edges and weights, and results map back to original IDs
+ */
+TEST_CASE("Vertex reordering" * WEIGHTED_ONLY) {
+    // Path 3-0-5-1-4-2 with scrambled labels
+    const int n = 6;
+    int path[n] = {3, 0, 5, 1, 4, 2};
+    Graph g(n);
+    for (int i = 0; i + 1 < n; ++i) {
+        g.addEdge(path[i], path[i + 1], i + 1);
+    }
+
+    int* rcm = Reordering::reverseCuthillMcKee(g);
+    Graph banded = Reordering::apply(g, rcm);
+    int bandwidth = 0;
+    for (int u = 0; u < n; ++u) {
+        int count;
+        Neighbor* neighbors = banded.getNeighbors(u, count);
+        for (int i = 0; i < count; ++i) {
+            int diff = neighbors[i].vertex - u;
+            if (diff < 0) diff = -diff;
+            if (diff > bandwidth) bandwidth = diff;
+        }
+        delete[] neighbors;
+    }
+    CHECK(bandwidth == 1);
+    CHECK(banded.edgeWeight(rcm[5], rcm[1]) == 3);
+
+    // Results computed on the relabeled graph map back to original IDs
+    int* inv = Reordering::inverse(rcm, n);
+    Graph tree = Reordering::apply(Algorithms::bfs(banded, rcm[3]), inv);
+    CHECK(tree.hasEdge(3, 0));
+    CHECK(tree.hasEdge(4, 2));
+    int reordered[n], original[n];
+    for (int v = 0; v < n; ++v) reordered[v] = banded.getDegree(v);
+    Reordering::mapBack(rcm, reordered, original, n);
+    CHECK(original[3] == 1);  // Path endpoint
+    CHECK(original[5] == 2);
+    delete[] inv;
+    delete[] rcm;
+
+    g.addEdge(5, 4);
+    g.addEdge(5, 2);
+    int* byDegree = Reordering::degreeOrder(g);
+    CHECK(byDegree[5] == 0);  // Vertex 5 now has the highest degree
+    int* bfs = Reordering::bfsOrder(g);
+    CHECK(bfs[5] == 0);
+    Graph relabeled = Reordering::apply(g, bfs);
+    CHECK(relabeled.getDegree(0) == 4);
+    delete[] byDegree;
+    delete[] bfs;
+
+    int bad[n] = {0, 0, 1, 2, 3, 4};
+    CHECK_THROWS_AS(Reordering::apply(g, bad), GraphException);
+}
+
+/**
+ * @brief Test case for the compressed graph representation
+ * 
+ * Validates CompressedGraph against the Graph it was built from:
+ * - Degrees and sorted neighbor lists (including negative and large weights
+ *   where Weight can hold them)
+ * - Weight elision when every weight is 1
+ * - BFS and Dijkstra on the compressed graph match the uncompressed results
+ * - Building from an edge array (over a million half-edges) encodes the same records
+ * - Moves transfer the encoded data and leave an empty graph behind
+ */
+TEST_CASE("Compressed graph" * WEIGHTED_ONLY) {
+    const Weight heavy = WIDE_WEIGHTS ? Weight(1000000) : Weight(100);
+    const Weight light = SIGNED_WEIGHTS ? Weight(-3) : Weight(3);
+    Graph g(300);
+    g.addEdge(0, 299, light);
+    g.addEdge(0, 5, heavy);
+    g.addEdge(5, 200, 2);
+    g.addEdge(200, 299, 1);
+    g.addEdge(7, 7, 4);  // Self-loop
+
+    CompressedGraph cg(g);
+    CHECK(cg.getVertexCount() == 300);
+    CHECK(!cg.hasUnitWeights());
+    CHECK(cg.getDegree(0) == 2);
+    CHECK(cg.getDegree(7) == 2);
+
+    int count;
+    Neighbor* neighbors = cg.getNeighbors(0, count);
+    REQUIRE(count == 2);
+    CHECK(neighbors[0].vertex == 5);  // Sorted by neighbor ID
+    CHECK(neighbors[0].weight == heavy);
+    CHECK(neighbors[1].vertex == 299);
+    CHECK(neighbors[1].weight == light);
+    delete[] neighbors;
+
+    g.updateWeight(0, 299, 7);
+    Graph fromGraph = Algorithms::dijkstra(g, 0);
+    CompressedGraph positive(g);
+    Graph fromCompressed = Algorithms::dijkstra(positive, 0);
+    CHECK(fromGraph.edgeWeight(200, 299) == fromCompressed.edgeWeight(200, 299));
+    CHECK(fromCompressed.hasEdge(0, 299));
+    CHECK(!fromCompressed.hasEdge(0, 5));  // 0-299-200-5 is shorter than the direct edge
+
+    // Unit-weight graphs store no weights at all
+    Graph path(1000);
+    for (int v = 0; v + 1 < 1000; ++v) {
+        path.addEdge(v, v + 1);
+    }
+    CompressedGraph compressedPath(path);
+    CHECK(compressedPath.hasUnitWeights());
+    CHECK(compressedPath.getByteSize() < 1000 * 3 + 1001 * 8);  // Degree and two 1-byte IDs per vertex
+    Graph tree = Algorithms::bfs(compressedPath, 0);
+    CHECK(tree.getDegree(999) == 1);
+    CHECK(tree.hasEdge(998, 999));
+    CHECK_THROWS_AS(compressedPath.getDegree(1000), GraphException);
+
+    // The edge-array constructor matches compressing a Graph of the same edges
+    const int chainLength = 300000;
+    const int edgeCount = 2 * chainLength + 1;  // Over 2^20 half-edges
+    Edge* edges = new Edge[edgeCount];
+    for (int i = 0; i < chainLength; ++i) {
+        edges[2 * i].src = i + 1;
+        edges[2 * i].dest = i;
+        edges[2 * i].weight = i % 5 - 2;
+        edges[2 * i + 1].src = i;
+        edges[2 * i + 1].dest = (i * 97) % (chainLength + 1);
+        edges[2 * i + 1].weight = i % 3;
+    }
+    edges[edgeCount - 1].src = 42;
+    edges[edgeCount - 1].dest = 42;  // Self-loop
+    edges[edgeCount - 1].weight = 9;
+    Graph chain(chainLength + 1);
+    chain.addEdges(edges, edgeCount);
+    CompressedGraph fromChain(chain);
+    CompressedGraph fromEdges(chainLength + 1, edges, edgeCount);
+    delete[] edges;
+    CHECK(fromEdges.getVertexCount() == chainLength + 1);
+    CHECK(fromEdges.getMaxDegree() == fromChain.getMaxDegree());
+    CHECK(fromEdges.getByteSize() == fromChain.getByteSize());
+    Neighbor* expected = new Neighbor[fromChain.getMaxDegree() + 1];
+    Neighbor* actual = new Neighbor[fromEdges.getMaxDegree() + 1];
+    bool same = true;
+    for (int v = 0; v <= chainLength && same; ++v) {
+        int degree = fromChain.copyNeighbors(v, expected);
+        same = fromEdges.copyNeighbors(v, actual) == degree;
+        for (int i = 0; i < degree && same; ++i) {
+            same = actual[i].vertex == expected[i].vertex && actual[i].weight == expected[i].weight;
+        }
+    }
+    CHECK(same);
+    CHECK(fromEdges.getDegree(42) >= 2);
+    delete[] expected;
+    delete[] actual;
+
+    Edge bad[1] = {{0, 3, 1}};
+    CHECK_THROWS_AS(CompressedGraph(3, bad, 1), GraphException);
+    CHECK_THROWS_AS(CompressedGraph(-1, bad, 0), GraphException);
+    CHECK_THROWS_AS(CompressedGraph(3, bad, -1), GraphException);
+    CompressedGraph empty(4, nullptr, 0);
+    CHECK(empty.getDegree(3) == 0);
+    CHECK(empty.hasUnitWeights());
+
+    // Moves transfer the encoded data in O(1)
+    long long bytes = compressedPath.getByteSize();
+    CompressedGraph moved(static_cast<CompressedGraph&&>(compressedPath));
+    CHECK(compressedPath.getVertexCount() == 0);
+    CHECK(compressedPath.getByteSize() == 0);
+    CHECK_THROWS_AS(compressedPath.getDegree(0), GraphException);
+    CHECK(moved.getByteSize() == bytes);
+    CHECK(moved.getDegree(500) == 2);
+    empty = static_cast<CompressedGraph&&>(moved);
+    CHECK(empty.getVertexCount() == 1000);
+    CHECK(moved.getVertexCount() == 0);
+}
+
+/**
+ * @brief Test case for wide path distances
+ * 
+ * Validates that shortest-path lengths are accumulated in the Distance type:
+ * summing two near-INT_MAX weights must not wrap around and make the longer
+ * path look shorter. Skipped when Weight is narrower than 32 bits.
+ */
+TEST_CASE("Dijkstra distances do not overflow" * WIDE_WEIGHTS_ONLY) {
+    Graph g(3);
+    g.addEdge(0, 1, Weight(2000000000));
+    g.addEdge(1, 2, Weight(2000000000));
+    g.addEdge(0, 2, Weight(2147483647));
+
+    Graph tree = Algorithms::dijkstra(g, 0);
+    CHECK(tree.hasEdge(0, 2));   // Direct edge is shorter than 0-1-2
+    CHECK(!tree.hasEdge(1, 2));
+    CHECK(tree.edgeWeight(0, 2) == 2147483647);
+
+    // Prim keeps heavy weights intact as well
+    Graph mst = Algorithms::prim(g);
+    CHECK(mst.hasEdge(0, 1));
+    CHECK(mst.hasEdge(1, 2));
+}
+
+/**
+ * @brief Test case for unweighted graph handling
+ * 
+ * Runs in both the default and the GRAPH_UNWEIGHTED build:
+ * - Graphs whose edges all have weight 1 report isUnweighted()
+ * - Dijkstra on such graphs returns the BFS shortest-path tree
+ * - In weighted builds, a non-unit weight switches back to weighted mode
+ */
+TEST_CASE("Unweighted graphs") {
+    Graph g(5);
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(0, 4);
+    g.addEdge(4, 3);
+    CHECK(g.isUnweighted());
+
+    Graph dTree = Algorithms::dijkstra(g, 0);
+    Graph bTree = Algorithms::bfs(g, 0);
+    bool sameTree = true;
+    for (int u = 0; u < 5; ++u) {
+        for (int v = u + 1; v < 5; ++v) {
+            if (dTree.hasEdge(u, v) != bTree.hasEdge(u, v)) sameTree = false;
+        }
+    }
+    CHECK(sameTree);
+    CHECK(dTree.hasEdge(4, 3));  // 3 is two hops away via 4, three via 1-2
+
+    CompressedGraph cg(g);
+    CHECK(cg.hasUnitWeights());
+    CHECK(Algorithms::dijkstra(cg, 0).hasEdge(0, 4));
+
+#ifndef GRAPH_UNWEIGHTED
+    g.updateWeight(0, 4, 10);
+    CHECK(!g.isUnweighted());
+    CHECK(!Algorithms::dijkstra(g, 0).hasEdge(0, 4));  // 4 is now cheaper via 1-2-3
+    g.removeEdge(4, 0);
+    CHECK(g.isUnweighted());
+#else
+    g.addEdge(1, 3, 10);  // Weight is ignored in unweighted builds
+    CHECK(g.edgeWeight(1, 3) == 1);
+    CHECK(g.isUnweighted());
+#endif
+}
+
+/**
+ * @brief Test case for directed graphs
+ * 
+ * Validates DirectedGraph and the directed algorithms:
+ * - Out- and in-adjacency, degrees and sorted neighbor lists
+ * - Edge lookup respects direction
+ * - BFS/DFS/Dijkstra follow out-edges; reverse variants follow in-edges
+ *   and return trees of original edges leading to the target
+ * - DFS matches recursive order and handles a 300k-vertex path without recursion
+ */
+TEST_CASE("Directed graphs" * WEIGHTED_ONLY) {
+    // 0 -> 1 -> 2 -> 3, shortcut 0 -> 3, and 4 -> 0 (4 unreachable from 0)
+    Edge edges[] = {{2, 3, 1}, {0, 3, 10}, {1, 2, 2}, {0, 1, 3}, {4, 0, 1}};
+    DirectedGraph g(5, edges, 5);
+    CHECK(g.getVertexCount() == 5);
+    CHECK(g.getEdgeCount() == 5);
+    CHECK(g.getDegree(0) == 2);
+    CHECK(g.getInDegree(0) == 1);
+    CHECK(g.getInDegree(3) == 2);
+    CHECK(g.getMaxDegree() == 2);
+    CHECK(g.hasEdge(0, 1));
+    CHECK(!g.hasEdge(1, 0));
+    CHECK(g.edgeWeight(0, 3) == 10);
+    CHECK_THROWS_AS(g.edgeWeight(3, 0), GraphException);
+    CHECK(!g.isUnweighted());
+
+    int count;
+    Neighbor* in = g.getInNeighbors(3, count);
+    REQUIRE(count == 2);
+    CHECK(in[0].vertex == 0);  // Sorted by source
+    CHECK(in[0].weight == 10);
+    CHECK(in[1].vertex == 2);
+    delete[] in;
+
+    DirectedGraph bfsTree = Algorithms::bfs(g, 0);
+    CHECK(bfsTree.getEdgeCount() == 3);
+    CHECK(bfsTree.hasEdge(0, 3));
+    CHECK(bfsTree.getInDegree(4) == 0);
+
+    DirectedGraph spt = Algorithms::dijkstra(g, 0);
+    CHECK(spt.hasEdge(2, 3));  // 0-1-2-3 costs 6, the shortcut 10
+    CHECK(!spt.hasEdge(0, 3));
+
+    // Every vertex can reach 3; the tree holds original edges pointing towards it
+    DirectedGraph toTarget = Algorithms::reverseDijkstra(g, 3);
+    CHECK(toTarget.getEdgeCount() == 4);
+    CHECK(toTarget.hasEdge(4, 0));
+    CHECK(toTarget.hasEdge(0, 1));
+    CHECK(toTarget.getDegree(3) == 0);
+
+    DirectedGraph reach = Algorithms::reverseBfs(g, 1);
+    CHECK(reach.getEdgeCount() == 2);  // 0 -> 1 and 4 -> 0
+    CHECK(Algorithms::dfs(g, 4).getEdgeCount() == 4);
+    CHECK(Algorithms::reverseDfs(g, 4).getEdgeCount() == 0);
+
+    // DFS descends before trying siblings: 2 is reached through 1, not from 0
+    Edge diamond[] = {{0, 1, 1}, {0, 2, 1}, {1, 2, 1}};
+    DirectedGraph shortcut(3, diamond, 3);
+    DirectedGraph depthFirst = Algorithms::dfs(shortcut, 0);
+    CHECK(depthFirst.hasEdge(1, 2));
+    CHECK(!depthFirst.hasEdge(0, 2));
+
+    // A long path does not overflow the call stack in either direction
+    const int pathLength = 300000;
+    Edge* arcs = new Edge[pathLength - 1];
+    for (int v = 0; v + 1 < pathLength; ++v) {
+        arcs[v].src = v;
+        arcs[v].dest = v + 1;
+        arcs[v].weight = 1;
+    }
+    DirectedGraph longPath(pathLength, arcs, pathLength - 1);
+    delete[] arcs;
+    DirectedGraph forward = Algorithms::dfs(longPath, 0);
+    CHECK(forward.getEdgeCount() == pathLength - 1);
+    CHECK(forward.hasEdge(pathLength - 2, pathLength - 1));
+    DirectedGraph backward = Algorithms::reverseDfs(longPath, pathLength - 1);
+    CHECK(backward.getEdgeCount() == pathLength - 1);
+    CHECK(backward.hasEdge(0, 1));
+    Graph undirectedPath(pathLength);
+    for (int v = 0; v + 1 < pathLength; ++v) {
+        undirectedPath.addEdge(v, v + 1);
+    }
+    Graph undirectedTree = Algorithms::dfs(undirectedPath, pathLength / 2);
+    CHECK(undirectedTree.getDegree(0) == 1);
+    CHECK(undirectedTree.getDegree(pathLength - 1) == 1);
+
+    DirectedGraph moved(static_cast<DirectedGraph&&>(g));
+    CHECK(moved.getEdgeCount() == 5);
+    CHECK(g.getVertexCount() == 0);
+
+    Edge bad[] = {{0, 5, 1}};
+    CHECK_THROWS_AS(DirectedGraph(5, bad, 1), GraphException);
+    CHECK_THROWS_AS(Algorithms::bfs(moved, 5), GraphException);
+}
+
+/**
+ * @brief Test case for triangle counting
+ * 
+ * Validates the Triangles class:
+ * - Sorted-set intersection on arrays long enough for the SIMD blocks
+ * - Counts on K4 with a self-loop and a parallel edge that must be ignored
+ * - Per-vertex counts and clustering against a brute-force count on a
+ *   pseudo-random graph
+ */
+TEST_CASE("Triangle counting") {
+    int a[40], b[30];
+    for (int i = 0; i < 40; ++i) a[i] = 3 * i;   // Multiples of 3 below 120
+    for (int i = 0; i < 30; ++i) b[i] = 4 * i;   // Multiples of 4 below 120
+    CHECK(Triangles::intersectCount(a, 40, b, 30) == 10);  // Multiples of 12
+    CHECK(Triangles::intersectCount(a, 40, a, 40) == 40);
+    CHECK(Triangles::intersectCount(a, 0, b, 30) == 0);
+
+    Graph k4(5);
+    for (int u = 0; u < 4; ++u) {
+        for (int v = u + 1; v < 4; ++v) k4.addEdge(u, v);
+    }
+    k4.addEdge(0, 1);  // Parallel edge
+    k4.addEdge(2, 2);  // Self-loop
+    k4.addEdge(3, 4);
+    CHECK(Triangles::count(k4) == 4);
+    long long* t = Triangles::perVertex(k4);
+    CHECK(t[0] == 3);
+    CHECK(t[3] == 3);
+    CHECK(t[4] == 0);
+    delete[] t;
+    double* c = Triangles::localClustering(k4);
+    CHECK(c[0] == doctest::Approx(1.0));
+    CHECK(c[3] == doctest::Approx(0.5));  // 3 of the 6 neighbor pairs are adjacent
+    CHECK(c[4] == 0.0);
+    delete[] c;
+    CHECK(Triangles::transitivity(k4) == doctest::Approx(12.0 / 15.0));
+
+    const int n = 60;
+    Graph g(n);
+    bool adj[n][n] = {};
+    unsigned int seed = 12345;
+    for (int u = 0; u < n; ++u) {
+        for (int v = u + 1; v < n; ++v) {
+            seed = seed * 1103515245u + 12345u;
+            if ((seed >> 16) % 4 == 0 || (u < 12 && v < 12)) {  // Dense core plus sparse rest
+                g.addEdge(u, v);
+                adj[u][v] = adj[v][u] = true;
+            }
+        }
+    }
+    long long expected = 0;
+    long long expectedAt[n] = {};
+    for (int u = 0; u < n; ++u) {
+        for (int v = u + 1; v < n; ++v) {
+            for (int w = v + 1; w < n; ++w) {
+                if (adj[u][v] && adj[v][w] && adj[u][w]) {
+                    expected++;
+                    expectedAt[u]++;
+                    expectedAt[v]++;
+                    expectedAt[w]++;
+                }
+            }
+        }
+    }
+    CHECK(Triangles::count(g) == expected);
+    t = Triangles::perVertex(g);
+    bool allMatch = true;
+    for (int v = 0; v < n; ++v) {
+        if (t[v] != expectedAt[v]) allMatch = false;
+    }
+    CHECK(allMatch);
+    delete[] t;
+}
+
+/**
+ * @brief Test case for k-core decomposition
+ * 
+ * Validates the Cores class:
+ * - Core numbers of a K4 with a triangle and a tail attached
+ * - Self-loops do not raise core numbers
+ * - Both peeling variants agree on a pseudo-random graph
+ * - kCore() keeps only the edges inside the core
+ */
+TEST_CASE("k-core decomposition") {
+    // K4 on 0-3, triangle 3-4-5, tail 5-6, isolated 7 with a self-loop
+    Graph g(8);
+    for (int u = 0; u < 4; ++u) {
+        for (int v = u + 1; v < 4; ++v) g.addEdge(u, v);
+    }
+    g.addEdge(3, 4);
+    g.addEdge(4, 5);
+    g.addEdge(5, 3);
+    g.addEdge(5, 6);
+    g.addEdge(7, 7);
+
+    int expected[8] = {3, 3, 3, 3, 2, 2, 1, 0};
+    int* core = Cores::coreNumbers(g);
+    int* parallel = Cores::coreNumbersParallel(g);
+    for (int v = 0; v < 8; ++v) {
+        CHECK(core[v] == expected[v]);
+        CHECK(parallel[v] == expected[v]);
+    }
+    delete[] core;
+    delete[] parallel;
+    CHECK(Cores::degeneracy(g) == 3);
+
+    Graph twoCore = Cores::kCore(g, 2);
+    CHECK(twoCore.getVertexCount() == 8);
+    CHECK(twoCore.hasEdge(4, 5));
+    CHECK(!twoCore.hasEdge(5, 6));
+    CHECK(twoCore.getDegree(7) == 0);
+    CHECK(Cores::kCore(g, 4).getDegree(0) == 0);
+    CHECK_THROWS_AS(Cores::kCore(g, -1), GraphException);
+
+    const int n = 300;
+    Graph r(n);
+    unsigned int seed = 777;
+    for (int i = 0; i < 2000; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 16) % n;
+        seed = seed * 1103515245u + 12345u;
+        int v = (seed >> 16) % (u + 1);  // Skewed towards low IDs
+        r.addEdge(u, v);
+    }
+    core = Cores::coreNumbers(r);
+    parallel = Cores::coreNumbersParallel(r);
+    bool same = true;
+    for (int v = 0; v < n; ++v) {
+        if (core[v] != parallel[v]) same = false;
+    }
+    CHECK(same);
+
+    // Every vertex of the k-core has at least k neighbors inside it
+    int k = Cores::degeneracy(r);
+    Graph densest = Cores::kCore(r, k);
+    bool enough = true;
+    for (int v = 0; v < n; ++v) {
+        if (core[v] < k) continue;
+        int count;
+        Neighbor* neighbors = densest.getNeighbors(v, count);
+        int inside = 0;
+        for (int i = 0; i < count; ++i) {
+            if (neighbors[i].vertex != v) inside++;
+        }
+        delete[] neighbors;
+        if (inside < k) enough = false;
+    }
+    CHECK(enough);
+    delete[] core;
+    delete[] parallel;
+}
+
+/**
+ * @brief Test case for PageRank
+ * 
+ * Validates the Centrality PageRank functions:
+ * - Ranks sum to 1 and follow the structure (star center, cycle symmetry)
+ * - A graph spanning several source segments matches a plain power iteration
+ * - Personalized ranks concentrate around the seed; weights shift rank
+ * - Directed ranks follow edge direction; invalid parameters throw
+ */
+TEST_CASE("PageRank") {
+    Graph star(6);
+    for (int v = 1; v < 6; ++v) star.addEdge(0, v);
+    double* rank = Centrality::pageRank(star);
+    double total = 0.0;
+    for (int v = 0; v < 6; ++v) total += rank[v];
+    CHECK(total == doctest::Approx(1.0));
+    CHECK(rank[0] > rank[1]);
+    CHECK(rank[1] == doctest::Approx(rank[5]));
+    delete[] rank;
+
+    // Path with long chords across source segments, against a naive iteration
+    const int n = 70000;
+    Graph big(n);
+    for (int v = 0; v + 1 < n; ++v) big.addEdge(v, v + 1);
+    for (int v = 0; v < n; v += 97) big.addEdge(v, (v * 7919) % n);
+    big.addVertex();  // Isolated vertex n
+    double* fast = Centrality::pageRank(big, 0.85, 0.0, 30);
+    double* naive = new double[n + 1];
+    double* next = new double[n + 1];
+    for (int v = 0; v <= n; ++v) naive[v] = 1.0 / (n + 1);
+    for (int it = 0; it < 30; ++it) {
+        double dangling = naive[n];
+        for (int v = 0; v <= n; ++v) next[v] = 0.0;
+        for (int u = 0; u < n; ++u) {
+            int count;
+            Neighbor* neighbors = big.getNeighbors(u, count);
+            for (int i = 0; i < count; ++i) next[neighbors[i].vertex] += naive[u] / count;
+            delete[] neighbors;
+        }
+        for (int v = 0; v <= n; ++v) next[v] = (0.15 + 0.85 * dangling) / (n + 1) + 0.85 * next[v];
+        swap(naive, next);
+    }
+    double maxError = 0.0;
+    for (int v = 0; v <= n; ++v) {
+        double error = fast[v] > naive[v] ? fast[v] - naive[v] : naive[v] - fast[v];
+        if (error > maxError) maxError = error;
+    }
+    CHECK(maxError < 1e-12);
+    delete[] fast;
+    delete[] naive;
+    delete[] next;
+
+    // Personalized: two triangles joined by one edge, seeded in the first
+    Graph twin(6);
+    twin.addEdge(0, 1);
+    twin.addEdge(1, 2);
+    twin.addEdge(2, 0);
+    twin.addEdge(3, 4);
+    twin.addEdge(4, 5);
+    twin.addEdge(5, 3);
+    twin.addEdge(2, 3);
+    double seed[6] = {1, 0, 0, 0, 0, 0};
+    rank = Centrality::personalizedPageRank(twin, seed);
+    CHECK(rank[0] > rank[1]);
+    CHECK(rank[1] > rank[4]);
+    delete[] rank;
+    double none[6] = {};
+    CHECK_THROWS_AS(Centrality::personalizedPageRank(twin, none), GraphException);
+    CHECK_THROWS_AS(Centrality::pageRank(twin, 1.5), GraphException);
+
+#ifndef GRAPH_UNWEIGHTED
+    twin.updateWeight(0, 1, 10);
+    rank = Centrality::weightedPageRank(twin);
+    double* plain = Centrality::pageRank(twin);
+    CHECK(rank[1] > plain[1]);  // The heavy edge draws the walk to 1
+    CHECK(rank[2] < plain[2]);
+    delete[] rank;
+    delete[] plain;
+    if (SIGNED_WEIGHTS) {
+        twin.updateWeight(0, 1, -1);
+        CHECK_THROWS_AS(Centrality::weightedPageRank(twin), GraphException);
+    }
+#endif
+
+    // Directed: 3 -> 0 -> 1 -> 2 -> 0; nothing points at 3
+    Edge edges[] = {{3, 0, 1}, {0, 1, 1}, {1, 2, 1}, {2, 0, 1}};
+    DirectedGraph dg(4, edges, 4);
+    rank = Centrality::pageRank(dg);
+    CHECK(rank[3] == doctest::Approx(0.15 / 4));
+    CHECK(rank[0] > rank[2]);
+    CHECK(rank[0] + rank[1] + rank[2] + rank[3] == doctest::Approx(1.0));
+    delete[] rank;
+}
+
+/**
+ * @brief Test case for betweenness centrality
+ * 
+ * Validates Brandes' algorithm in the Centrality class:
+ * - Exact scores on a path, a star and a 4-cycle (split shortest paths)
+ * - Weighted graphs use weighted shortest paths
+ * - Sampling every source reproduces the exact scores, and a partial
+ *   sample stays within the Hoeffding error bound
+ */
+TEST_CASE("Betweenness centrality") {
+    Graph path(5);
+    for (int v = 0; v + 1 < 5; ++v) path.addEdge(v, v + 1);
+    double* score = Centrality::betweenness(path);
+    CHECK(score[0] == doctest::Approx(0.0));
+    CHECK(score[1] == doctest::Approx(3.0));  // Pairs {0,2}, {0,3}, {0,4}
+    CHECK(score[2] == doctest::Approx(4.0));
+    delete[] score;
+
+    Graph cycle(4);
+    cycle.addEdge(0, 1);
+    cycle.addEdge(1, 2);
+    cycle.addEdge(2, 3);
+    cycle.addEdge(3, 0);
+    score = Centrality::betweenness(cycle);
+    CHECK(score[0] == doctest::Approx(0.5));  // Half of the paths between 1 and 3
+    delete[] score;
+
+#ifndef GRAPH_UNWEIGHTED
+    Graph triangle(3);
+    triangle.addEdge(0, 1, 10);
+    triangle.addEdge(0, 2, 1);
+    triangle.addEdge(2, 1, 1);
+    score = Centrality::betweenness(triangle);
+    CHECK(score[2] == doctest::Approx(1.0));  // 0-2-1 is shorter than 0-1
+    CHECK(score[0] == doctest::Approx(0.0));
+    delete[] score;
+    triangle.updateWeight(0, 1, 0);
+    CHECK_THROWS_AS(Centrality::betweenness(triangle), GraphException);
+#endif
+
+    const int n = 200;
+    Graph g(n);
+    unsigned int seed = 99;
+    for (int v = 1; v < n; ++v) {
+        seed = seed * 1103515245u + 12345u;
+        g.addEdge(v, (seed >> 16) % v);  // Random tree plus extra edges
+        if (v % 3 == 0) g.addEdge(v, (seed >> 8) % n);
+    }
+    double* exact = Centrality::betweenness(g);
+    double* all = Centrality::approximateBetweenness(g, n + 10);
+    double* sampled = Centrality::approximateBetweenness(g, 100, 7);
+    double bound = Centrality::betweennessErrorBound(n, 100, 0.01);
+    bool same = true, within = true;
+    for (int v = 0; v < n; ++v) {
+        double diff = all[v] - exact[v];
+        if (diff > 1e-6 || diff < -1e-6) same = false;
+        diff = sampled[v] - exact[v];
+        if (diff > bound || diff < -bound) within = false;
+    }
+    CHECK(same);
+    CHECK(within);
+    delete[] exact;
+    delete[] all;
+    delete[] sampled;
+    CHECK_THROWS_AS(Centrality::approximateBetweenness(g, 0), GraphException);
+    CHECK_THROWS_AS(Centrality::betweennessErrorBound(n, 10, 1.0), GraphException);
+}
+
+// Whether removing vertex 'skip' splits its connected component (brute force)
+static bool splitsComponent(const Graph& g, int skip) {
+    int n = g.getVertexCount();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    int count = g.copyNeighbors(skip, neighbors);
+    int start = -1;
+    for (int i = 0; i < count && start == -1; ++i) {
+        if (neighbors[i].vertex != skip) start = neighbors[i].vertex;
+    }
+    bool* seen = new bool[n]();
+    int* stack = new int[n];
+    int top = 0;
+    bool split = false;
+    if (start != -1) {
+        seen[skip] = seen[start] = true;
+        stack[top++] = start;
+        while (top > 0) {
+            int u = stack[--top];
+            int c = g.copyNeighbors(u, neighbors);
+            for (int i = 0; i < c; ++i) {
+                int w = neighbors[i].vertex;
+                if (!seen[w]) {
+                    seen[w] = true;
+                    stack[top++] = w;
+                }
+            }
+        }
+        count = g.copyNeighbors(skip, neighbors);
+        for (int i = 0; i < count; ++i) {
+            if (!seen[neighbors[i].vertex]) split = true;
+        }
+    }
+    delete[] neighbors;
+    delete[] seen;
+    delete[] stack;
+    return split;
+}
+
+// Sort edges (and their labels) by (src, dest)
+static void sortEdges(Edge* edges, int* label, int count) {
+    for (int i = 1; i < count; ++i) {
+        for (int j = i; j > 0 && (edges[j].src < edges[j - 1].src ||
+                                  (edges[j].src == edges[j - 1].src && edges[j].dest < edges[j - 1].dest)); --j) {
+            swap(edges[j], edges[j - 1]);
+            if (label) swap(label[j], label[j - 1]);
+        }
+    }
+}
+
+/**
+ * @brief Test case for bridges, articulation points and biconnected components
+ * 
+ * Validates the Connectivity class:
+ * - Known results on two triangles joined at a vertex, with a bridge and
+ *   a doubled edge (parallel copies are never bridges)
+ * - The iterative DFS handles a 200000-vertex path without recursion
+ * - The parallel Tarjan-Vishkin results match the sequential ones on a
+ *   random graph, and articulation points match a brute-force check
+ */
+TEST_CASE("Bridges, articulation points and biconnected components") {
+    // Triangles 0-1-2 and 2-3-4, bridge 4-5, doubled edge 5-6, self-loop at 1
+    Graph g(8);
+    Edge list[] = {{0, 1, 1}, {1, 2, 1}, {2, 0, 1}, {2, 3, 1}, {3, 4, 1}, {4, 2, 1},
+                   {4, 5, 1}, {5, 6, 1}, {6, 5, 1}, {1, 1, 1}};
+    g.addEdges(list, 10);
+
+    for (int parallel = 0; parallel < 2; ++parallel) {
+        int count = 0;
+        Edge* br = parallel ? Connectivity::bridgesParallel(g, count) : Connectivity::bridges(g, count);
+        REQUIRE(count == 1);
+        CHECK(br[0].src == 4);
+        CHECK(br[0].dest == 5);
+        delete[] br;
+
+        bool* cut = parallel ? Connectivity::articulationPointsParallel(g) : Connectivity::articulationPoints(g);
+        bool expected[] = {false, false, true, false, true, true, false, false};
+        bool same = true;
+        for (int v = 0; v < 8; ++v) {
+            if (cut[v] != expected[v]) same = false;
+        }
+        CHECK(same);
+        delete[] cut;
+
+        Edge* edges = nullptr;
+        int* component = nullptr;
+        int edgeCount = 0;
+        int k = parallel ? Connectivity::biconnectedComponentsParallel(g, edges, component, edgeCount)
+                         : Connectivity::biconnectedComponents(g, edges, component, edgeCount);
+        CHECK(k == 4);
+        REQUIRE(edgeCount == 9);
+        sortEdges(edges, component, edgeCount);
+        CHECK(component[0] == component[1]);  // 0-1, 0-2 and 1-2
+        CHECK(component[0] == component[2]);
+        CHECK(component[3] == component[4]);  // 2-3, 2-4 and 3-4
+        CHECK(component[3] != component[0]);
+        CHECK(component[7] == component[8]);  // Both copies of 5-6
+        delete[] edges;
+        delete[] component;
+    }
+
+    const int length = 200000;
+    Graph path(length);
+    for (int v = 0; v + 1 < length; ++v) path.addEdge(v, v + 1);
+    int count = 0;
+    Edge* br = Connectivity::bridges(path, count);
+    CHECK(count == length - 1);
+    delete[] br;
+    bool* cut = Connectivity::articulationPoints(path);
+    CHECK(!cut[0]);
+    CHECK(cut[1]);
+    CHECK(cut[length - 2]);
+    delete[] cut;
+
+    const int n = 300;
+    Graph random(n);
+    unsigned int seed = 5;
+    for (int i = 0; i < 420; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int u = (seed >> 16) % n;
+        seed = seed * 1103515245u + 12345u;
+        random.addEdge(u, (seed >> 16) % n);
+    }
+    int seqCount = 0, parCount = 0;
+    Edge* seqBridges = Connectivity::bridges(random, seqCount);
+    Edge* parBridges = Connectivity::bridgesParallel(random, parCount);
+    REQUIRE(seqCount == parCount);
+    sortEdges(seqBridges, nullptr, seqCount);
+    sortEdges(parBridges, nullptr, parCount);
+    bool same = true;
+    for (int i = 0; i < seqCount; ++i) {
+        if (seqBridges[i].src != parBridges[i].src || seqBridges[i].dest != parBridges[i].dest) same = false;
+    }
+    CHECK(same);
+    delete[] seqBridges;
+    delete[] parBridges;
+
+    bool* seqCut = Connectivity::articulationPoints(random);
+    bool* parCut = Connectivity::articulationPointsParallel(random);
+    bool matches = true;
+    for (int v = 0; v < n; ++v) {
+        if (seqCut[v] != parCut[v] || seqCut[v] != splitsComponent(random, v)) matches = false;
+    }
+    CHECK(matches);
+    delete[] seqCut;
+    delete[] parCut;
+
+    // Same partition: component labels correspond one to one
+    Edge *seqEdges = nullptr, *parEdges = nullptr;
+    int *seqLabel = nullptr, *parLabel = nullptr;
+    int seqEdgeCount = 0, parEdgeCount = 0;
+    int seqK = Connectivity::biconnectedComponents(random, seqEdges, seqLabel, seqEdgeCount);
+    int parK = Connectivity::biconnectedComponentsParallel(random, parEdges, parLabel, parEdgeCount);
+    REQUIRE(seqK == parK);
+    REQUIRE(seqEdgeCount == parEdgeCount);
+    sortEdges(seqEdges, seqLabel, seqEdgeCount);
+    sortEdges(parEdges, parLabel, parEdgeCount);
+    int* toPar = new int[seqK];
+    int* toSeq = new int[parK];
+    for (int c = 0; c < seqK; ++c) toPar[c] = toSeq[c] = -1;
+    bool bijection = true;
+    for (int i = 0; i < seqEdgeCount; ++i) {
+        int a = seqLabel[i], b = parLabel[i];
+        if (seqEdges[i].src != parEdges[i].src || seqEdges[i].dest != parEdges[i].dest) bijection = false;
+        if (toPar[a] == -1 && toSeq[b] == -1) {
+            toPar[a] = b;
+            toSeq[b] = a;
+        } else if (toPar[a] != b || toSeq[b] != a) {
+            bijection = false;
+        }
+    }
+    CHECK(bijection);
+    delete[] seqEdges;
+    delete[] parEdges;
+    delete[] seqLabel;
+    delete[] parLabel;
+    delete[] toPar;
+    delete[] toSeq;
+}
+
+// Minimum cut by trying every split of the first n vertices (brute force)
+static Distance bruteForceMinCut(const Edge* edges, int m, int n) {
+    Distance best = UNREACHABLE_DISTANCE;
+    for (int mask = 1; mask < (1 << (n - 1)); ++mask) {
+        Distance cut = 0;
+        for (int i = 0; i < m; ++i) {
+            if (((mask >> edges[i].src) ^ (mask >> edges[i].dest)) & 1) cut += edges[i].weight;
+        }
+        if (cut < best) best = cut;
+    }
+    return best;
+}
+
+// Total weight of the edges between the two sides
+static Distance cutValue(const Graph& g, const bool* side) {
+    Distance cut = 0;
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    for (int v = 0; v < g.getVertexCount(); ++v) {
+        int count = g.copyNeighbors(v, neighbors);
+        for (int i = 0; i < count; ++i) {
+            if (side[v] && !side[neighbors[i].vertex]) cut += neighbors[i].weight;
+        }
+    }
+    delete[] neighbors;
+    return cut;
+}
+
+/**
+ * @brief Test case for global minimum cuts
+ * 
+ * Validates the MinCut class:
+ * - Stoer-Wagner on the example graph of the original paper (cut 4)
+ * - Stoer-Wagner and Karger-Stein match a brute-force minimum on random
+ *   weighted graphs, and the returned sides have the returned value
+ * - Disconnected graphs have a zero cut; invalid inputs throw
+ */
+TEST_CASE("Minimum cut") {
+    bool* side = nullptr;
+#ifndef GRAPH_UNWEIGHTED
+    Graph paper(8);
+    Edge list[] = {{0, 1, 2}, {0, 4, 3}, {1, 2, 3}, {1, 4, 2}, {1, 5, 2}, {2, 3, 4},
+                   {2, 6, 2}, {3, 6, 2}, {3, 7, 2}, {4, 5, 3}, {5, 6, 1}, {6, 7, 3}};
+    paper.addEdges(list, 12);
+    CHECK(MinCut::stoerWagner(paper, side) == 4);
+    CHECK(side[2] == side[3]);  // {2, 3, 6, 7} against {0, 1, 4, 5}
+    CHECK(side[2] == side[6]);
+    CHECK(side[2] == side[7]);
+    CHECK(side[2] != side[0]);
+    delete[] side;
+    CHECK(MinCut::kargerStein(paper, side) == 4);
+    delete[] side;
+
+    if (SIGNED_WEIGHTS) {
+        paper.updateWeight(0, 1, -1);
+        CHECK_THROWS_AS(MinCut::stoerWagner(paper, side), GraphException);
+    }
+#endif
+
+    unsigned int seed = 17;
+    bool allMatch = true;
+    for (int round = 0; round < 20; ++round) {
+        const int n = 12;
+        Edge edges[40];
+        int m = 0;
+        for (int v = 1; v < n; ++v) {  // Random spanning tree keeps the graph connected
+            seed = seed * 1103515245u + 12345u;
+            edges[m++] = {v, (int)((seed >> 16) % v), (Weight)(1 + (seed >> 8) % 9)};
+        }
+        while (m < 40) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            edges[m++] = {u, (int)((seed >> 16) % n), (Weight)(1 + (seed >> 8) % 9)};
+        }
+        Graph g(n);
+        g.addEdges(edges, m);
+        for (int i = 0; i < m; ++i) {
+            if (edges[i].src == edges[i].dest) edges[i].weight = 0;  // Loops never cross
+#ifdef GRAPH_UNWEIGHTED
+            if (edges[i].src != edges[i].dest) edges[i].weight = 1;
+#endif
+        }
+        Distance expected = bruteForceMinCut(edges, m, n);
+        Distance exact = MinCut::stoerWagner(g, side);
+        if (exact != expected || cutValue(g, side) != exact) allMatch = false;
+        delete[] side;
+        Distance randomized = MinCut::kargerStein(g, side, 0, round + 1);
+        if (randomized != expected || cutValue(g, side) != randomized) allMatch = false;
+        delete[] side;
+    }
+    CHECK(allMatch);
+
+    Graph split(5);
+    split.addEdge(0, 1, 3);
+    split.addEdge(2, 3, 3);
+    split.addEdge(3, 4, 3);
+    split.removeVertex(4);
+    CHECK(MinCut::stoerWagner(split, side) == 0);
+    CHECK(!side[4]);
+    delete[] side;
+    CHECK(MinCut::kargerStein(split, side) == 0);
+    CHECK(side[0] == side[1]);
+    CHECK(side[0] != side[2]);
+    delete[] side;
+
+    Graph single(1);
+    CHECK_THROWS_AS(MinCut::stoerWagner(single, side), GraphException);
+    CHECK_THROWS_AS(MinCut::kargerStein(split, side, -1), GraphException);
+}
+
+// Maximum flow by Edmonds-Karp on a capacity matrix (brute force reference)
+static Distance referenceMaxFlow(Distance* capacity, int n, int s, int t) {
+    Distance flow = 0;
+    int* parent = new int[n];
+    int* queue = new int[n];
+    while (true) {
+        for (int v = 0; v < n; ++v) parent[v] = -1;
+        parent[s] = s;
+        int head = 0, tail = 0;
+        queue[tail++] = s;
+        while (head < tail && parent[t] == -1) {
+            int u = queue[head++];
+            for (int v = 0; v < n; ++v) {
+                if (parent[v] == -1 && capacity[u * n + v] > 0) {
+                    parent[v] = u;
+                    queue[tail++] = v;
+                }
+            }
+        }
+        if (parent[t] == -1) break;
+        Distance push = UNREACHABLE_DISTANCE;
+        for (int v = t; v != s; v = parent[v]) {
+            if (capacity[parent[v] * n + v] < push) push = capacity[parent[v] * n + v];
+        }
+        for (int v = t; v != s; v = parent[v]) {
+            capacity[parent[v] * n + v] -= push;
+            capacity[v * n + parent[v]] += push;
+        }
+        flow += push;
+    }
+    delete[] parent;
+    delete[] queue;
+    return flow;
+}
+
+/**
+ * @brief Test case for maximum flow
+ * 
+ * Validates the MaxFlow class:
+ * - The classic CLRS network (maximum flow 23) and its minimum cut
+ * - Random undirected and directed networks against Edmonds-Karp, with
+ *   the cut capacity equal to the flow value
+ * - Unreachable sinks and invalid arguments
+ */
+TEST_CASE("Maximum flow") {
+    bool* side = nullptr;
+#ifndef GRAPH_UNWEIGHTED
+    Edge clrs[] = {{0, 1, 16}, {0, 2, 13}, {2, 1, 4}, {1, 3, 12}, {3, 2, 9},
+                   {2, 4, 14}, {4, 3, 7}, {3, 5, 20}, {4, 5, 4}};
+    DirectedGraph network(6, clrs, 9);
+    CHECK(MaxFlow::maxFlow(network, 0, 5) == 23);
+    CHECK(MaxFlow::minCut(network, 0, 5, side) == 23);
+    CHECK(side[0]);
+    CHECK(side[1]);  // Cut {0, 1, 2, 4} | {3, 5}: 12 + 7 + 4
+    CHECK(side[2]);
+    CHECK(side[4]);
+    CHECK(!side[3]);
+    CHECK(!side[5]);
+    delete[] side;
+#endif
+
+    const int n = 25;
+    Distance* capacity = new Distance[n * n];
+    unsigned int seed = 3;
+    bool flowsMatch = true, cutsMatch = true;
+    for (int round = 0; round < 20; ++round) {
+        bool directed = round % 2 == 1;
+        Edge edges[90];
+        for (int i = 0; i < n * n; ++i) capacity[i] = 0;
+        for (int i = 0; i < 90; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            Weight w = (Weight)(1 + (seed >> 8) % 20);
+#ifdef GRAPH_UNWEIGHTED
+            w = 1;
+#endif
+            edges[i] = {u, v, w};
+            if (u == v) continue;
+            capacity[u * n + v] += w;
+            if (!directed) capacity[v * n + u] += w;
+        }
+        Distance expected = referenceMaxFlow(capacity, n, 0, n - 1);
+        Distance flow, cut = 0;
+        Neighbor* neighbors = nullptr;
+        int count = 0;
+        if (directed) {
+            DirectedGraph dg(n, edges, 90);
+            flow = MaxFlow::minCut(dg, 0, n - 1, side);
+            for (int u = 0; u < n; ++u) {
+                neighbors = dg.getNeighbors(u, count);
+                for (int i = 0; i < count; ++i) {
+                    if (side[u] && !side[neighbors[i].vertex]) cut += neighbors[i].weight;
+                }
+                delete[] neighbors;
+            }
+        } else {
+            Graph g(n);
+            g.addEdges(edges, 90);
+            flow = MaxFlow::minCut(g, 0, n - 1, side);
+            for (int u = 0; u < n; ++u) {
+                neighbors = g.getNeighbors(u, count);
+                for (int i = 0; i < count; ++i) {
+                    if (side[u] && !side[neighbors[i].vertex]) cut += neighbors[i].weight;
+                }
+                delete[] neighbors;
+            }
+        }
+        if (flow != expected) flowsMatch = false;
+        if (cut != flow || !side[0] || side[n - 1]) cutsMatch = false;
+        delete[] side;
+    }
+    CHECK(flowsMatch);
+    CHECK(cutsMatch);
+    delete[] capacity;
+
+    Graph apart(4);
+    apart.addEdge(0, 1, 5);
+    apart.addEdge(2, 3, 5);
+    CHECK(MaxFlow::maxFlow(apart, 0, 3) == 0);
+    CHECK_THROWS_AS(MaxFlow::maxFlow(apart, 0, 0), GraphException);
+    CHECK_THROWS_AS(MaxFlow::maxFlow(apart, 0, 4), GraphException);
+}
+
+// Whether mate is a valid matching of g with 'size' pairs
+static bool isMatching(const Graph& g, const int* mate, int size) {
+    int pairs = 0;
+    for (int v = 0; v < g.getVertexCount(); ++v) {
+        if (mate[v] == -1) continue;
+        if (mate[mate[v]] != v || !g.hasEdge(v, mate[v])) return false;
+        if (v < mate[v]) pairs++;
+    }
+    return pairs == size;
+}
+
+// Maximum matching size by simple augmenting paths (brute force reference)
+static bool augmentFrom(const Graph& g, int u, int* mate, bool* visited) {
+    int count = 0;
+    Neighbor* neighbors = g.getNeighbors(u, count);
+    bool found = false;
+    for (int i = 0; i < count && !found; ++i) {
+        int v = neighbors[i].vertex;
+        if (visited[v]) continue;
+        visited[v] = true;
+        if (mate[v] == -1 || augmentFrom(g, mate[v], mate, visited)) {
+            mate[u] = v;
+            mate[v] = u;
+            found = true;
+        }
+    }
+    delete[] neighbors;
+    return found;
+}
+
+/**
+ * @brief Test case for bipartite matching
+ * 
+ * Validates the Matching class:
+ * - Bipartiteness of even and odd cycles; bipartition() throws on odd ones
+ * - Hopcroft-Karp sizes match simple augmenting paths on random graphs
+ * - Minimum-weight assignment on a 3x3 cost matrix, and against all
+ *   permutations of a random 5x5 cost matrix with negative weights
+ */
+TEST_CASE("Bipartite matching") {
+    Graph even(4), odd(3);
+    for (int v = 0; v < 4; ++v) even.addEdge(v, (v + 1) % 4);
+    for (int v = 0; v < 3; ++v) odd.addEdge(v, (v + 1) % 3);
+    CHECK(Matching::isBipartite(even));
+    CHECK(!Matching::isBipartite(odd));
+    bool* side = Matching::bipartition(even);
+    CHECK(side[0] == side[2]);
+    CHECK(side[0] != side[1]);
+    delete[] side;
+    CHECK_THROWS_AS(Matching::bipartition(odd), GraphException);
+    int size = 0;
+    CHECK_THROWS_AS(Matching::maximumMatching(odd, size), GraphException);
+
+    unsigned int seed = 11;
+    bool sizesMatch = true;
+    for (int round = 0; round < 20; ++round) {
+        const int half = 40;
+        Graph g(2 * half);
+        for (int i = 0; i < 2 * half + round * 3; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % half;
+            seed = seed * 1103515245u + 12345u;
+            g.addEdge(u, half + (seed >> 16) % half);
+        }
+        int* mate = Matching::maximumMatching(g, size);
+        int* reference = new int[2 * half];
+        bool* visited = new bool[2 * half];
+        for (int v = 0; v < 2 * half; ++v) reference[v] = -1;
+        int expected = 0;
+        for (int u = 0; u < half; ++u) {
+            for (int v = 0; v < 2 * half; ++v) visited[v] = false;
+            if (augmentFrom(g, u, reference, visited)) expected++;
+        }
+        if (size != expected || !isMatching(g, mate, size)) sizesMatch = false;
+        delete[] mate;
+        delete[] reference;
+        delete[] visited;
+    }
+    CHECK(sizesMatch);
+
+#ifndef GRAPH_UNWEIGHTED
+    // Workers 0-2, jobs 3-5; the cheapest assignment is 0-4, 1-3, 2-5 (1 + 2 + 2)
+    Weight cost[3][3] = {{4, 1, 3}, {2, 0, 5}, {3, 2, 2}};
+    Graph workers(6);
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) workers.addEdge(i, 3 + j, cost[i][j]);
+    }
+    Distance total = 0;
+    int* mate = Matching::minWeightAssignment(workers, size, total);
+    CHECK(size == 3);
+    CHECK(total == 5);
+    CHECK(mate[0] == 4);
+    delete[] mate;
+
+    // All 120 permutations of a random 5x5 matrix with weights in [-10, 10]
+    Weight random[5][5];
+    Graph complete(10);
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            seed = seed * 1103515245u + 12345u;
+            random[i][j] = (Weight)((seed >> 16) % 21) - 10;
+            complete.addEdge(i, 5 + j, random[i][j]);
+        }
+    }
+    Distance best = 0;
+    bool first = true;
+    int perm[5] = {0, 1, 2, 3, 4};
+    for (int p = 0; p < 120; ++p) {
+        Distance sum = 0;
+        for (int i = 0; i < 5; ++i) sum += random[i][perm[i]];
+        if (first || sum < best) best = sum;
+        first = false;
+        // Next permutation in lexicographic order
+        int i = 3;
+        while (i >= 0 && perm[i] > perm[i + 1]) i--;
+        if (i < 0) break;
+        int j = 4;
+        while (perm[j] < perm[i]) j--;
+        swap(perm[i], perm[j]);
+        for (int l = i + 1, r = 4; l < r; ++l, --r) swap(perm[l], perm[r]);
+    }
+    mate = Matching::minWeightAssignment(complete, size, total);
+    CHECK(size == 5);
+    CHECK(total == best);
+    CHECK(isMatching(complete, mate, size));
+    delete[] mate;
+#endif
+}
+
+// Every community induces a connected subgraph
+static bool communitiesConnected(const Graph& g, const int* community) {
+    int n = g.getVertexCount();
+    bool* seen = new bool[n]();
+    bool* rooted = new bool[n]();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    Queue queue(n);
+    bool connected = true;
+    for (int root = 0; root < n; ++root) {
+        if (seen[root]) continue;
+        if (rooted[community[root]]) connected = false;
+        rooted[community[root]] = true;
+        seen[root] = true;
+        queue.enqueue(root);
+        while (!queue.isEmpty()) {
+            int u = queue.dequeue();
+            int count = g.copyNeighbors(u, neighbors);
+            for (int j = 0; j < count; ++j) {
+                int v = neighbors[j].vertex;
+                if (!seen[v] && community[v] == community[u]) {
+                    seen[v] = true;
+                    queue.enqueue(v);
+                }
+            }
+        }
+    }
+    delete[] seen;
+    delete[] rooted;
+    delete[] neighbors;
+    return connected;
+}
+
+/**
+ * @brief Test case for community detection
+ * 
+ * Validates the Community class:
+ * - A ring of cliques splits into its cliques, with and without refinement
+ * - Reported modularity matches modularity() of the returned partition
+ * - On random planted partitions the modularity is within 0.01 of the
+ *   planted one, and refined communities are connected
+ * - Edge-less graphs, resolution and index validation
+ */
+TEST_CASE("Community detection") {
+    // Eight 5-cliques, consecutive cliques joined by one edge
+    Graph ring(40);
+    for (int c = 0; c < 8; ++c) {
+        for (int i = 0; i < 5; ++i) {
+            for (int j = i + 1; j < 5; ++j) ring.addEdge(5 * c + i, 5 * c + j);
+        }
+        ring.addEdge(5 * c + 4, (5 * c + 5) % 40);
+    }
+    for (int pass = 0; pass < 2; ++pass) {
+        int communities = 0;
+        double q = 0.0;
+        int* community = Community::louvain(ring, communities, q, pass == 1);
+        CHECK(communities == 8);
+        bool cliquesIntact = true;
+        for (int v = 0; v < 40; ++v) {
+            if (community[v] != community[v - v % 5]) cliquesIntact = false;
+        }
+        CHECK(cliquesIntact);
+        CHECK(q == doctest::Approx(Community::modularity(ring, community)));
+        CHECK(q > 0.7);
+        delete[] community;
+    }
+
+    unsigned seed = 2024;
+    bool nearPlanted = true;
+    bool connected = true;
+    for (int trial = 0; trial < 10; ++trial) {
+        int n = 300, groups = 6;
+        Graph g(n);
+        int* planted = new int[n];
+        for (int v = 0; v < n; ++v) planted[v] = v % groups;
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                seed = seed * 1103515245u + 12345u;
+                unsigned r = (seed >> 16) % 1000;
+                if ((planted[u] == planted[v] && r < 120) || r < 4) g.addEdge(u, v);
+            }
+        }
+        double plantedQ = Community::modularity(g, planted);
+        for (int pass = 0; pass < 2; ++pass) {
+            int communities = 0;
+            double q = 0.0;
+            int* community = Community::louvain(g, communities, q, pass == 1);
+            if (q < plantedQ - 0.01) nearPlanted = false;
+            if (pass == 1 && !communitiesConnected(g, community)) connected = false;
+            delete[] community;
+        }
+        delete[] planted;
+    }
+    CHECK(nearPlanted);
+    CHECK(connected);
+
+    Graph empty(4);
+    int communities = 0;
+    double q = 1.0;
+    int* community = Community::louvain(empty, communities, q);
+    CHECK(communities == 4);
+    CHECK(q == 0.0);
+    CHECK_THROWS_AS(Community::louvain(ring, communities, q, false, 0.0), GraphException);
+    community[0] = 4;
+    CHECK_THROWS_AS(Community::modularity(empty, community), GraphException);
+    delete[] community;
+
+#ifndef GRAPH_UNWEIGHTED
+    if (SIGNED_WEIGHTS) {
+        Graph negative(2);
+        negative.addEdge(0, 1, -1);
+        CHECK_THROWS_AS(Community::louvain(negative, communities, q), GraphException);
+    }
+#endif
+}
+
+// Every vertex with neighbors holds a label of maximum neighbor weight
+static bool labelsStable(const Graph& g, const int* label) {
+    int n = g.getVertexCount();
+    Weight* weightTo = new Weight[n]();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    bool stable = true;
+    for (int v = 0; v < n; ++v) {
+        int count = g.copyNeighbors(v, neighbors);
+        Weight best = 0;
+        for (int j = 0; j < count; ++j) {
+            int w = neighbors[j].vertex;
+            if (w == v) continue;
+            weightTo[label[w]] += neighbors[j].weight;
+            if (weightTo[label[w]] > best) best = weightTo[label[w]];
+        }
+        if (count > 0 && weightTo[label[v]] < best) stable = false;
+        for (int j = 0; j < count; ++j) weightTo[label[neighbors[j].vertex]] = 0;
+    }
+    delete[] weightTo;
+    delete[] neighbors;
+    return stable;
+}
+
+/**
+ * @brief Test case for label propagation
+ * 
+ * Validates Community::labelPropagation():
+ * - A ring of cliques splits into its cliques
+ * - On random planted partitions the labels converge to a stable state,
+ *   and almost all planted groups (55 of 60) end up mostly in one community
+ * - maxIterations = 0 leaves every vertex alone; negative values throw
+ */
+TEST_CASE("Label propagation") {
+    Graph ring(40);
+    for (int c = 0; c < 8; ++c) {
+        for (int i = 0; i < 5; ++i) {
+            for (int j = i + 1; j < 5; ++j) ring.addEdge(5 * c + i, 5 * c + j);
+        }
+        ring.addEdge(5 * c + 4, (5 * c + 5) % 40);
+    }
+    int communities = 0;
+    int* label = Community::labelPropagation(ring, communities);
+    CHECK(communities == 8);
+    bool cliquesIntact = true;
+    for (int v = 0; v < 40; ++v) {
+        if (label[v] != label[v - v % 5]) cliquesIntact = false;
+    }
+    CHECK(cliquesIntact);
+    CHECK(labelsStable(ring, label));
+    delete[] label;
+
+    unsigned seed = 77;
+    bool stable = true;
+    int groupsKept = 0;
+    for (int trial = 0; trial < 10; ++trial) {
+        int n = 300, groups = 6;
+        Graph g(n);
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                seed = seed * 1103515245u + 12345u;
+                unsigned r = (seed >> 16) % 1000;
+                if ((u % groups == v % groups && r < 200) || r < 2) g.addEdge(u, v);
+            }
+        }
+        label = Community::labelPropagation(g, communities, 1000);
+        if (!labelsStable(g, label)) stable = false;
+        int* votes = new int[n];
+        for (int group = 0; group < groups; ++group) {
+            for (int c = 0; c < n; ++c) votes[c] = 0;
+            int top = 0;
+            for (int v = group; v < n; v += groups) {
+                if (++votes[label[v]] > top) top = votes[label[v]];
+            }
+            if (top >= 45) groupsKept++;
+        }
+        delete[] votes;
+        delete[] label;
+    }
+    CHECK(stable);
+    CHECK(groupsKept >= 55);
+
+    label = Community::labelPropagation(ring, communities, 0);
+    CHECK(communities == 40);
+    delete[] label;
+    CHECK_THROWS_AS(Community::labelPropagation(ring, communities, -1), GraphException);
+}
+
+/**
+ * @brief Test case for vertex coloring
+ * 
+ * Validates the Coloring class:
+ * - Exact color counts on even/odd cycles and a complete graph
+ * - All four orders give proper colorings on random graphs, within
+ *   maxDegree + 1 colors, and smallest-last within degeneracy + 1
+ * - Jones-Plassmann is reproducible for a fixed seed
+ * - isProper() rejects an improper coloring
+ */
+TEST_CASE("Graph coloring") {
+    Graph even(6), odd(5), complete(6);
+    for (int v = 0; v < 6; ++v) even.addEdge(v, (v + 1) % 6);
+    for (int v = 0; v < 5; ++v) odd.addEdge(v, (v + 1) % 5);
+    for (int u = 0; u < 6; ++u) {
+        for (int v = u + 1; v < 6; ++v) complete.addEdge(u, v);
+    }
+    int colors = 0;
+    int* color = Coloring::smallestLast(even, colors);
+    CHECK(colors == 2);
+    delete[] color;
+    color = Coloring::largestFirst(odd, colors);
+    CHECK(colors == 3);
+    delete[] color;
+    color = Coloring::jonesPlassmann(complete, colors);
+    CHECK(colors == 6);
+    delete[] color;
+    color = Coloring::speculative(complete, colors);
+    CHECK(colors == 6);
+    CHECK(Coloring::isProper(complete, color));
+    color[5] = color[0];
+    CHECK(!Coloring::isProper(complete, color));
+    delete[] color;
+
+    unsigned seed = 5;
+    bool proper = true, withinDegree = true, withinDegeneracy = true, reproducible = true;
+    for (int trial = 0; trial < 20; ++trial) {
+        int n = 50 + trial * 20;
+        Graph g(n);
+        for (int e = 0; e < 4 * n; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            g.addEdge(u, v);
+        }
+        int maxColors = g.getMaxDegree() + 1;
+        for (int method = 0; method < 4; ++method) {
+            if (method == 0) color = Coloring::largestFirst(g, colors);
+            if (method == 1) color = Coloring::smallestLast(g, colors);
+            if (method == 2) color = Coloring::jonesPlassmann(g, colors, trial);
+            if (method == 3) color = Coloring::speculative(g, colors);
+            if (!Coloring::isProper(g, color)) proper = false;
+            if (colors > maxColors) withinDegree = false;
+            if (method == 1 && colors > Cores::degeneracy(g) + 1) withinDegeneracy = false;
+            if (method == 2) {
+                int again = 0;
+                int* other = Coloring::jonesPlassmann(g, again, trial);
+                for (int v = 0; v < n; ++v) {
+                    if (other[v] != color[v]) reproducible = false;
+                }
+                delete[] other;
+            }
+            delete[] color;
+        }
+    }
+    CHECK(proper);
+    CHECK(withinDegree);
+    CHECK(withinDegeneracy);
+    CHECK(reproducible);
+}
+
+// No two members are adjacent and every non-member has a member neighbor
+static bool isMaximalIndependent(const Graph& g, const bool* member) {
+    int n = g.getVertexCount();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    bool valid = true;
+    for (int u = 0; u < n && valid; ++u) {
+        int count = g.copyNeighbors(u, neighbors);
+        bool covered = member[u];
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            if (v == u) continue;
+            if (member[u] && member[v]) valid = false;
+            if (member[v]) covered = true;
+        }
+        if (!covered) valid = false;
+    }
+    delete[] neighbors;
+    return valid;
+}
+
+/**
+ * @brief Test case for maximal independent sets
+ * 
+ * Validates Coloring::maximalIndependentSet() and its parallel variant:
+ * - The greedy set of a path takes every other vertex
+ * - Both sets are independent and maximal on random graphs
+ * - The parallel set equals color 0 of Jones-Plassmann with the same seed
+ */
+TEST_CASE("Maximal independent set") {
+    Graph path(7);
+    for (int v = 0; v + 1 < 7; ++v) path.addEdge(v, v + 1);
+    int size = 0;
+    bool* member = Coloring::maximalIndependentSet(path, size);
+    CHECK(size == 4);
+    bool alternating = true;
+    for (int v = 0; v < 7; ++v) {
+        if (member[v] != (v % 2 == 0)) alternating = false;
+    }
+    CHECK(alternating);
+    delete[] member;
+
+    unsigned seed = 11;
+    bool valid = true, matchesColoring = true, sizesCounted = true;
+    for (int trial = 0; trial < 20; ++trial) {
+        int n = 40 + trial * 25;
+        Graph g(n);
+        for (int e = 0; e < 3 * n; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            g.addEdge(u, v);
+        }
+        for (int parallel = 0; parallel < 2; ++parallel) {
+            member = parallel ? Coloring::maximalIndependentSetParallel(g, size, trial)
+                              : Coloring::maximalIndependentSet(g, size);
+            if (!isMaximalIndependent(g, member)) valid = false;
+            int counted = 0;
+            for (int v = 0; v < n; ++v) counted += member[v];
+            if (counted != size) sizesCounted = false;
+            if (parallel) {
+                int colors = 0;
+                int* color = Coloring::jonesPlassmann(g, colors, trial);
+                for (int v = 0; v < n; ++v) {
+                    if (member[v] != (color[v] == 0)) matchesColoring = false;
+                }
+                delete[] color;
+            }
+            delete[] member;
+        }
+    }
+    CHECK(valid);
+    CHECK(sizesCounted);
+    CHECK(matchesColoring);
+}
+
+/**
+ * @brief Test case for eccentricities and the diameter
+ * 
+ * Validates the Eccentricity class against Floyd-Warshall on random
+ * graphs, many of them disconnected:
+ * - diameter() and weightedDiameter() (iFUB)
+ * - eccentricities() and weightedEccentricityBounds() run to convergence
+ * - Bounds from a few searches enclose the exact eccentricities
+ * - A path's diameter, and argument validation
+ */
+TEST_CASE("Eccentricity and diameter") {
+    Graph path(10);
+    for (int v = 0; v + 1 < 10; ++v) path.addEdge(v, v + 1);
+    CHECK(Eccentricity::diameter(path) == 9);
+    int* ecc = Eccentricity::eccentricities(path);
+    CHECK(ecc[0] == 9);
+    CHECK(ecc[4] == 5);
+    delete[] ecc;
+
+    unsigned seed = 31;
+    bool diameters = true, weightedDiameters = true, exact = true, weightedExact = true;
+    bool enclosed = true, budgetKept = true;
+    for (int trial = 0; trial < 30; ++trial) {
+        int n = 10 + trial * 2;
+        Graph g(n);
+        for (int e = 0; e < n + trial % 7 * 3; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            if (u != v && !g.hasEdge(u, v)) g.addEdge(u, v, 1 + (seed >> 16) % 9);
+        }
+
+        // Floyd-Warshall in hops and in weights, UNREACHABLE_DISTANCE for unreachable
+        Distance* hops = new Distance[n * n];
+        Distance* dist = new Distance[n * n];
+        for (int i = 0; i < n * n; ++i) hops[i] = dist[i] = UNREACHABLE_DISTANCE;
+        Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+        for (int u = 0; u < n; ++u) {
+            hops[u * n + u] = dist[u * n + u] = 0;
+            int count = g.copyNeighbors(u, neighbors);
+            for (int i = 0; i < count; ++i) {
+                hops[u * n + neighbors[i].vertex] = 1;
+                dist[u * n + neighbors[i].vertex] = neighbors[i].weight;
+            }
+        }
+        delete[] neighbors;
+        for (int k = 0; k < n; ++k) {
+            for (int i = 0; i < n; ++i) {
+                for (int j = 0; j < n; ++j) {
+                    Distance* m[2] = {hops, dist};
+                    for (int t = 0; t < 2; ++t) {
+                        Distance a = m[t][i * n + k], b = m[t][k * n + j];
+                        if (a == UNREACHABLE_DISTANCE || b == UNREACHABLE_DISTANCE) continue;
+                        if (a + b < m[t][i * n + j]) m[t][i * n + j] = a + b;
+                    }
+                }
+            }
+        }
+        Distance diameter = 0, weightedDiameter = 0;
+        ecc = Eccentricity::eccentricities(g);
+        int* lower = nullptr;
+        int* upper = nullptr;
+        int used = Eccentricity::eccentricityBounds(g, 3, lower, upper);
+        if (used > 3) budgetKept = false;
+        Distance* wLower = nullptr;
+        Distance* wUpper = nullptr;
+        Eccentricity::weightedEccentricityBounds(g, n, wLower, wUpper);
+        for (int u = 0; u < n; ++u) {
+            Distance e = 0, we = 0;
+            for (int v = 0; v < n; ++v) {
+                if (hops[u * n + v] == UNREACHABLE_DISTANCE) continue;
+                if (hops[u * n + v] > e) e = hops[u * n + v];
+                if (dist[u * n + v] > we) we = dist[u * n + v];
+            }
+            if (e > diameter) diameter = e;
+            if (we > weightedDiameter) weightedDiameter = we;
+            if (static_cast<Distance>(ecc[u]) != e) exact = false;
+            if (static_cast<Distance>(lower[u]) > e || static_cast<Distance>(upper[u]) < e) enclosed = false;
+            if (wLower[u] != we || wUpper[u] != we) weightedExact = false;
+        }
+        if (static_cast<Distance>(Eccentricity::diameter(g)) != diameter) diameters = false;
+        if (Eccentricity::weightedDiameter(g) != weightedDiameter) weightedDiameters = false;
+        delete[] ecc;
+        delete[] lower;
+        delete[] upper;
+        delete[] wLower;
+        delete[] wUpper;
+        delete[] hops;
+        delete[] dist;
+    }
+    CHECK(diameters);
+    CHECK(weightedDiameters);
+    CHECK(exact);
+    CHECK(weightedExact);
+    CHECK(enclosed);
+    CHECK(budgetKept);
+
+    int* lower = nullptr;
+    int* upper = nullptr;
+    CHECK_THROWS_AS(Eccentricity::eccentricityBounds(path, -1, lower, upper), GraphException);
+#ifndef GRAPH_UNWEIGHTED
+    if (SIGNED_WEIGHTS) {
+        Graph negative(2);
+        negative.addEdge(0, 1, -1);
+        CHECK_THROWS_AS(Eccentricity::weightedDiameter(negative), GraphException);
+    }
+#endif
+}
+
+/**
+ * @brief Test case for all-pairs shortest paths
+ * 
+ * Validates ShortestPaths against a plain Floyd-Warshall on random graphs
+ * spanning several 64 x 64 tiles:
+ * - floydWarshall() and johnson() on directed graphs with negative weights
+ *   (weights shifted by vertex potentials, so there is no negative cycle)
+ * - Both on undirected graphs, with unreachable pairs
+ * - Negative cycles are reported
+ * - DistanceMatrix save()/load() round trip and bounds checks
+ */
+TEST_CASE("All-pairs shortest paths") {
+    unsigned seed = 57;
+    bool directedMatch = true, undirectedMatch = true;
+    for (int trial = 0; trial < 6; ++trial) {
+        int n = 20 + trial * 27;
+        int m = n * (2 + trial % 3);
+        Distance* potential = new Distance[n];
+        for (int v = 0; v < n; ++v) {
+            seed = seed * 1103515245u + 12345u;
+            potential[v] = (seed >> 16) % 20;
+        }
+        Edge* edges = new Edge[m];
+        Graph g(n);
+        for (int e = 0; e < m; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            Weight w = 1 + (seed >> 16) % 9;
+            edges[e].src = u;
+            edges[e].dest = v;
+            edges[e].weight = static_cast<Weight>(w + potential[u] - potential[v]);
+            if (e % 2 == 0 && u != v && !g.hasEdge(u, v)) g.addEdge(u, v, w);
+        }
+        DirectedGraph dg(n, edges, m);
+
+        for (int directed = 0; directed < 2; ++directed) {
+            // Plain Floyd-Warshall with reached flags (distances may be negative)
+            Distance* dist = new Distance[n * n];
+            bool* known = new bool[n * n]();
+            int maxDegree = directed ? dg.getMaxDegree() : g.getMaxDegree();
+            Neighbor* neighbors = new Neighbor[maxDegree + 1];
+            for (int u = 0; u < n; ++u) {
+                dist[u * n + u] = 0;
+                known[u * n + u] = true;
+                int count = directed ? dg.copyNeighbors(u, neighbors) : g.copyNeighbors(u, neighbors);
+                for (int i = 0; i < count; ++i) {
+                    int c = u * n + neighbors[i].vertex;
+                    if (!known[c] || neighbors[i].weight < dist[c]) dist[c] = neighbors[i].weight;
+                    known[c] = true;
+                }
+            }
+            delete[] neighbors;
+            for (int k = 0; k < n; ++k) {
+                for (int i = 0; i < n; ++i) {
+                    if (!known[i * n + k]) continue;
+                    for (int j = 0; j < n; ++j) {
+                        if (!known[k * n + j]) continue;
+                        Distance via = dist[i * n + k] + dist[k * n + j];
+                        if (!known[i * n + j] || via < dist[i * n + j]) dist[i * n + j] = via;
+                        known[i * n + j] = true;
+                    }
+                }
+            }
+
+            DistanceMatrix blocked = directed ? ShortestPaths::floydWarshall(dg) : ShortestPaths::floydWarshall(g);
+            DistanceMatrix sparse = directed ? ShortestPaths::johnson(dg) : ShortestPaths::johnson(g);
+            bool match = blocked.getVertexCount() == n && sparse.getVertexCount() == n;
+            for (int u = 0; u < n && match; ++u) {
+                for (int v = 0; v < n; ++v) {
+                    int c = u * n + v;
+                    Distance expected = known[c] ? dist[c] : DistanceMatrix::unreachable();
+                    if (blocked.getDistance(u, v) != expected || sparse.getDistance(u, v) != expected ||
+                        blocked.isReachable(u, v) != known[c]) {
+                        match = false;
+                    }
+                }
+            }
+            if (!match) {
+                if (directed) directedMatch = false;
+                else undirectedMatch = false;
+            }
+            delete[] known;
+            delete[] dist;
+        }
+        delete[] potential;
+        delete[] edges;
+    }
+    CHECK(directedMatch);
+    CHECK(undirectedMatch);
+
+#ifndef GRAPH_UNWEIGHTED
+    if (SIGNED_WEIGHTS) {
+        Edge cycle[] = {{0, 1, 2}, {1, 2, Weight(-4)}, {2, 0, 1}, {2, 3, 1}};
+        DirectedGraph negativeCycle(4, cycle, 4);
+        CHECK_THROWS_AS(ShortestPaths::floydWarshall(negativeCycle), GraphException);
+        CHECK_THROWS_AS(ShortestPaths::johnson(negativeCycle), GraphException);
+        Graph negativeEdge(3);
+        negativeEdge.addEdge(1, 2, -1);
+        CHECK_THROWS_AS(ShortestPaths::floydWarshall(negativeEdge), GraphException);
+        CHECK_THROWS_AS(ShortestPaths::johnson(negativeEdge), GraphException);
+    }
+#endif
+
+    Graph path(4);
+    path.addEdge(0, 1, 1);
+    path.addEdge(1, 2, 1);
+    DistanceMatrix saved = ShortestPaths::johnson(path);
+    const char* file = "test_distance_matrix.bin";
+    saved.save(file);
+    DistanceMatrix loaded = DistanceMatrix::load(file);
+    std::remove(file);
+    CHECK(loaded.getVertexCount() == 4);
+    CHECK(loaded.getDistance(0, 2) == 2);
+    CHECK(loaded.getDistance(2, 0) == 2);
+    CHECK_FALSE(loaded.isReachable(0, 3));
+    CHECK(loaded.row(1)[2] == 1);
+    CHECK_THROWS_AS(loaded.getDistance(0, 4), GraphException);
+    CHECK_THROWS_AS(DistanceMatrix::load("missing_distance_matrix.bin"), GraphException);
+    DistanceMatrix moved = static_cast<DistanceMatrix&&>(loaded);
+    CHECK(moved.getDistance(0, 1) == 1);
+    CHECK(loaded.getVertexCount() == 0);
+}
+
+/**
+ * @brief Test case for single-source shortest paths with negative weights
+ * 
+ * Validates the negative-weight paths of ShortestPaths:
+ * - bellmanFord() and spfa() match the Floyd-Warshall rows on random
+ *   directed graphs with negative weights, with consistent predecessors
+ * - Negative cycles reachable from the source throw, others do not matter
+ * - negativeCycle() returns a real negative cycle, or nothing
+ * - Algorithms::dijkstra() rejects negative weights
+ * - Queue front insertion used by SLF
+ *
+ * Skipped in unweighted builds and when Weight is unsigned.
+ */
+TEST_CASE("Negative weights and cycles" * NEGATIVE_WEIGHTS_ONLY) {
+    Queue queue(3);
+    queue.enqueue(1);
+    queue.enqueueFront(2);
+    queue.enqueue(3);
+    CHECK(queue.size() == 3);
+    CHECK(queue.peek() == 2);
+    CHECK_THROWS_AS(queue.enqueueFront(4), GraphException);
+    CHECK(queue.dequeue() == 2);
+    CHECK(queue.dequeue() == 1);
+
+    unsigned seed = 71;
+    bool distancesMatch = true, parentsValid = true;
+    for (int trial = 0; trial < 20; ++trial) {
+        int n = 5 + trial * 4;
+        int m = n * (1 + trial % 4);
+        Distance* potential = new Distance[n];
+        for (int v = 0; v < n; ++v) {
+            seed = seed * 1103515245u + 12345u;
+            potential[v] = (seed >> 16) % 30;
+        }
+        bool* used = new bool[n * n]();
+        Edge* edges = new Edge[m];
+        int count = 0;
+        for (int e = 0; e < m; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            if (u == v || used[u * n + v]) continue;
+            used[u * n + v] = true;
+            Distance w = 1 + (seed >> 16) % 9 + potential[u] - potential[v];
+            edges[count++] = {u, v, static_cast<Weight>(w)};
+        }
+        DirectedGraph g(n, edges, count);
+        DistanceMatrix all = ShortestPaths::floydWarshall(g);
+        for (int source = 0; source < n; source += 3) {
+            for (int method = 0; method < 2; ++method) {
+                int* parent = nullptr;
+                Distance* dist = method == 0 ? ShortestPaths::bellmanFord(g, source, parent)
+                                             : ShortestPaths::spfa(g, source, parent);
+                for (int v = 0; v < n; ++v) {
+                    if (dist[v] != all.getDistance(source, v)) distancesMatch = false;
+                    if (v == source || !all.isReachable(source, v)) {
+                        if (parent[v] != -1) parentsValid = false;
+                    } else if (parent[v] == -1 || !g.hasEdge(parent[v], v) ||
+                               dist[parent[v]] + g.edgeWeight(parent[v], v) != dist[v]) {
+                        parentsValid = false;
+                    }
+                }
+                delete[] dist;
+                delete[] parent;
+            }
+        }
+        delete[] potential;
+        delete[] used;
+        delete[] edges;
+    }
+    CHECK(distancesMatch);
+    CHECK(parentsValid);
+
+    // 1 -> 2 -> 3 -> 1 weighs -1; vertex 4 only leads into it, 0 is separate
+    Edge cyclic[] = {{1, 2, 4}, {2, 3, Weight(-6)}, {3, 1, 1}, {4, 1, 2}, {0, 5, Weight(-3)}};
+    DirectedGraph g(6, cyclic, 5);
+    int* parent = nullptr;
+    CHECK_THROWS_AS(ShortestPaths::bellmanFord(g, 4, parent), GraphException);
+    CHECK_THROWS_AS(ShortestPaths::spfa(g, 2, parent), GraphException);
+    Distance* dist = ShortestPaths::spfa(g, 0, parent);
+    CHECK(dist[5] == -3);
+    CHECK(parent[5] == 0);
+    CHECK(dist[1] == DistanceMatrix::unreachable());
+    delete[] dist;
+    delete[] parent;
+    CHECK_THROWS_AS(ShortestPaths::bellmanFord(g, 6, parent), GraphException);
+
+    int length = 0;
+    int* cycle = ShortestPaths::negativeCycle(g, length);
+    REQUIRE(cycle != nullptr);
+    CHECK(length == 3);
+    Distance total = 0;
+    bool closed = true;
+    for (int i = 0; i < length; ++i) {
+        int u = cycle[i], v = cycle[(i + 1) % length];
+        if (!g.hasEdge(u, v)) closed = false;
+        else total += g.edgeWeight(u, v);
+    }
+    CHECK(closed);
+    CHECK(total < 0);
+    delete[] cycle;
+
+    Edge acyclic[] = {{0, 1, Weight(-2)}, {1, 2, Weight(-2)}, {0, 2, 1}};
+    DirectedGraph dag(3, acyclic, 3);
+    CHECK(ShortestPaths::negativeCycle(dag, length) == nullptr);
+    CHECK(length == 0);
+    Graph undirected(3);
+    undirected.addEdge(0, 1, 2);
+    undirected.addEdge(1, 2, -1);
+    cycle = ShortestPaths::negativeCycle(undirected, length);
+    CHECK(length == 2);
+    delete[] cycle;
+
+    CHECK_THROWS_AS(Algorithms::dijkstra(undirected, 0), GraphException);
+    CHECK_THROWS_AS(Algorithms::dijkstra(dag, 0), GraphException);
+    CompressedGraph compressed(undirected);
+    CHECK_THROWS_AS(Algorithms::dijkstra(compressed, 0), GraphException);
+}
+
+/**
+ * @brief Test case for k shortest loopless paths
+ * 
+ * Validates ShortestPaths::kShortestPaths against the sorted lengths of all
+ * simple paths on small random graphs, directed and undirected:
+ * - Lengths come in order and match the k smallest
+ * - Every path is simple, runs from source to target along real edges,
+ *   has the stated length, and no path is repeated
+ * - Fewer paths when there are no more, none when the target is unreachable
+ * - A KShortestPaths reused across queries matches fresh calls
+ * - Argument validation
+ */
+TEST_CASE("K shortest paths") {
+    unsigned seed = 89;
+    bool lengthsMatch = true, pathsValid = true;
+    for (int trial = 0; trial < 40; ++trial) {
+        int n = 4 + trial % 6;
+        Graph g(n);
+        Edge* edges = new Edge[3 * n];
+        int m = 0;
+        for (int e = 0; e < 3 * n; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            Weight w = static_cast<Weight>((seed >> 16) % 6);
+            if (u == v) continue;
+            if (!g.hasEdge(u, v)) g.addEdge(u, v, w);
+            bool duplicate = false;
+            for (int i = 0; i < m; ++i) duplicate = duplicate || (edges[i].src == u && edges[i].dest == v);
+            if (!duplicate) edges[m++] = {u, v, w};
+        }
+        DirectedGraph dg(n, edges, m);
+        delete[] edges;
+
+        for (int directed = 0; directed < 2; ++directed) {
+            int source = trial % n, target = (trial / 3) % n;
+            Distance* all = new Distance[100000];
+            bool* onPath = new bool[n]();
+            int total = 0;
+            if (directed) allPathLengths(dg, source, target, 0, onPath, all, total);
+            else allPathLengths(g, source, target, 0, onPath, all, total);
+            for (int i = 1; i < total; ++i) {
+                for (int j = i; j > 0 && all[j] < all[j - 1]; --j) swap(all[j], all[j - 1]);
+            }
+            int k = 1 + trial % 12;
+            int* offsets = nullptr;
+            int* vertices = nullptr;
+            Distance* lengths = nullptr;
+            int found = directed ? ShortestPaths::kShortestPaths(dg, source, target, k, offsets, vertices, lengths)
+                                 : ShortestPaths::kShortestPaths(g, source, target, k, offsets, vertices, lengths);
+            if (found != (total < k ? total : k)) lengthsMatch = false;
+            for (int p = 0; p < found && p < total; ++p) {
+                if (lengths[p] != all[p]) lengthsMatch = false;
+                const int* path = vertices + offsets[p];
+                int size = offsets[p + 1] - offsets[p];
+                if (path[0] != source || path[size - 1] != target) pathsValid = false;
+                Distance length = 0;
+                for (int v = 0; v < n; ++v) onPath[v] = false;
+                for (int i = 0; i < size; ++i) {
+                    if (onPath[path[i]]) pathsValid = false;
+                    onPath[path[i]] = true;
+                    if (i + 1 == size) continue;
+                    bool edge = directed ? dg.hasEdge(path[i], path[i + 1]) : g.hasEdge(path[i], path[i + 1]);
+                    if (!edge) {
+                        pathsValid = false;
+                        break;
+                    }
+                    length += directed ? dg.edgeWeight(path[i], path[i + 1]) : g.edgeWeight(path[i], path[i + 1]);
+                }
+                if (length != lengths[p]) pathsValid = false;
+                for (int q = 0; q < p; ++q) {
+                    int other = offsets[q + 1] - offsets[q];
+                    bool same = other == size;
+                    for (int i = 0; i < size && same; ++i) same = vertices[offsets[q] + i] == path[i];
+                    if (same) pathsValid = false;
+                }
+            }
+            delete[] offsets;
+            delete[] vertices;
+            delete[] lengths;
+            delete[] all;
+            delete[] onPath;
+        }
+    }
+    CHECK(lengthsMatch);
+    CHECK(pathsValid);
+
+    {
+        int n = 30;
+        Graph g(n);
+        Edge* edges = new Edge[4 * n];
+        int m = 0;
+        for (int e = 0; e < 4 * n; ++e) {
+            seed = seed * 1103515245u + 12345u;
+            int u = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            int v = (seed >> 16) % n;
+            seed = seed * 1103515245u + 12345u;
+            Weight w = static_cast<Weight>((seed >> 16) % 6);
+            if (u == v) continue;
+            if (!g.hasEdge(u, v)) g.addEdge(u, v, w);
+            bool duplicate = false;
+            for (int i = 0; i < m; ++i) duplicate = duplicate || (edges[i].src == u && edges[i].dest == v);
+            if (!duplicate) edges[m++] = {u, v, w};
+        }
+        DirectedGraph dg(n, edges, m);
+        delete[] edges;
+        KShortestPaths undirectedQuery(g);
+        KShortestPaths directedQuery(dg);
+        bool reuseMatches = true;
+        for (int query = 0; query < 24; ++query) {
+            bool directed = query % 2 == 1;
+            int source = (query * 7) % n, target = (query * 11 + 3) % n, k = query % 9;
+            int* offsets = nullptr;
+            int* vertices = nullptr;
+            Distance* lengths = nullptr;
+            int* freshOffsets = nullptr;
+            int* freshVertices = nullptr;
+            Distance* freshLengths = nullptr;
+            int found = directed ? directedQuery.find(source, target, k, offsets, vertices, lengths)
+                                 : undirectedQuery.find(source, target, k, offsets, vertices, lengths);
+            int fresh = directed
+                ? ShortestPaths::kShortestPaths(dg, source, target, k, freshOffsets, freshVertices, freshLengths)
+                : ShortestPaths::kShortestPaths(g, source, target, k, freshOffsets, freshVertices, freshLengths);
+            if (found != fresh) reuseMatches = false;
+            for (int p = 0; p < found && p < fresh; ++p) {
+                if (lengths[p] != freshLengths[p] || offsets[p + 1] != freshOffsets[p + 1]) {
+                    reuseMatches = false;
+                    continue;
+                }
+                for (int i = offsets[p]; i < offsets[p + 1]; ++i) {
+                    if (vertices[i] != freshVertices[i]) reuseMatches = false;
+                }
+            }
+            delete[] offsets;
+            delete[] vertices;
+            delete[] lengths;
+            delete[] freshOffsets;
+            delete[] freshVertices;
+            delete[] freshLengths;
+        }
+        CHECK(reuseMatches);
+    }
+
+    Graph split(4);
+    split.addEdge(0, 1, 1);
+    split.addEdge(2, 3, 1);
+    int* offsets = nullptr;
+    int* vertices = nullptr;
+    Distance* lengths = nullptr;
+    CHECK(ShortestPaths::kShortestPaths(split, 0, 3, 5, offsets, vertices, lengths) == 0);
+    delete[] offsets;
+    delete[] vertices;
+    delete[] lengths;
+    CHECK(ShortestPaths::kShortestPaths(split, 1, 1, 5, offsets, vertices, lengths) == 1);
+    CHECK(offsets[1] == 1);
+    CHECK(lengths[0] == 0);
+    delete[] offsets;
+    delete[] vertices;
+    delete[] lengths;
+    CHECK_THROWS_AS(ShortestPaths::kShortestPaths(split, 0, 4, 1, offsets, vertices, lengths), GraphException);
+    CHECK_THROWS_AS(ShortestPaths::kShortestPaths(split, 0, 1, -1, offsets, vertices, lengths), GraphException);
+#ifndef GRAPH_UNWEIGHTED
+    if (SIGNED_WEIGHTS) {
+        split.addEdge(1, 2, -1);
+        CHECK_THROWS_AS(ShortestPaths::kShortestPaths(split, 0, 3, 1, offsets, vertices, lengths), GraphException);
+        CHECK_THROWS_AS(KShortestPaths query(split), GraphException);
+    }
+#endif
+}
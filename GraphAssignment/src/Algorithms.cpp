@@ -3,123 +3,399 @@
 
 #include "Graph.h"
 #include "Algorithms.h"
+#include "CompressedGraph.h"
+#include "DirectedGraph.h"
 #include "data_structures/Queue.h"
 #include "data_structures/PriorityQueue.h"
 #include "data_structures/UnionFind.h"
 #include "GraphException.h"
 #include <iostream>
-#include <climits>
 //s
 namespace graph {
 
-// BFS: Breadth-First Search returning a BFS tree rooted at 'start'
-Graph Algorithms::bfs(const Graph& g, int start) {
+// Read-only view of a DirectedGraph that follows edges backwards: the
+// traversal interface is forwarded to the in-adjacency (CSC), so the
+// templates below run reverse traversals without building a transpose.
+struct InEdges {
+    const DirectedGraph& g;
+    int getVertexCount() const { return g.getVertexCount(); }
+    int getDegree(int v) const { return g.getInDegree(v); }
+    int getMaxDegree() const { return g.getMaxInDegree(); }
+    Neighbor* getNeighbors(int v, int& count) const { return g.getInNeighbors(v, count); }
+    int copyNeighbors(int v, Neighbor* out) const { return g.copyInNeighbors(v, out); }
+};
+
+static void checkStart(int n, int start) {
+    if (start < 0 || start >= n)
+        throw GraphException("Vertex index out of bounds");
+}
+
+// BFS over any graph type exposing getVertexCount/getMaxDegree/copyNeighbors;
+// one neighbor buffer is reused for every vertex. Fills parent/via (parent -1
+// for the start and unreached vertices) and the discovery order, and returns
+// the number of vertices reached. The caller validates start.
+template<typename G>
+static int bfsParents(const G& g, int start, int* parent, Weight* via, int* order) {
     int n = g.getVertexCount();
-    Graph tree(n);
     bool* visited = new bool[n]();
-    Queue q(n);
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    for (int v = 0; v < n; ++v) parent[v] = -1;
 
+    int head = 0, tail = 0;
     visited[start] = true;
-    q.enqueue(start);
+    order[tail++] = start;
 
-    while (!q.isEmpty()) {
-        int u = q.dequeue();
-        int count;
-        Neighbor* neighbors = g.getNeighbors(u, count);
+    while (head < tail) {
+        int u = order[head++];
+        int count = g.copyNeighbors(u, neighbors);
         for (int i = 0; i < count; ++i) {
             int v = neighbors[i].vertex;
-            int w = neighbors[i].weight;
             if (!visited[v]) {
                 visited[v] = true;
-                tree.addEdge(u, v, w);
-                q.enqueue(v);
+                parent[v] = u;
+                via[v] = neighbors[i].weight;
+                order[tail++] = v;
             }
         }
-        delete[] neighbors;
     }
+    delete[] neighbors;
     delete[] visited;
+    return tail;
+}
+
+// Undirected BFS tree, edges added in discovery order
+template<typename G>
+static Graph bfsTree(const G& g, int start) {
+    int n = g.getVertexCount();
+    checkStart(n, start);
+    int* parent = new int[n];
+    Weight* via = new Weight[n];
+    int* order = new int[n];
+    int reached = bfsParents(g, start, parent, via, order);
+    Graph tree(n);
+    for (int i = 1; i < reached; ++i) {
+        int v = order[i];
+        tree.addEdge(parent[v], v, via[v]);
+    }
+    delete[] parent;
+    delete[] via;
+    delete[] order;
     return tree;
 }
 
-// DFS helper
-void dfs_visit(const Graph& g, int u, bool* visited, Graph& tree) {
-    visited[u] = true;
-    int count;
-    Neighbor* neighbors = g.getNeighbors(u, count);
-    for (int i = 0; i < count; ++i) {
-        int v = neighbors[i].vertex;
-        int w = neighbors[i].weight;
-        if (!visited[v]) {
-            tree.addEdge(u, v, w);
-            dfs_visit(g, v, visited, tree);
+// Directed tree from parent links, edges listed in 'order'. Forward trees
+// hold parent -> v; trees of a reverse traversal hold the original edges
+// v -> parent, i.e. every path in them leads to the root.
+static DirectedGraph directedTree(int n, const int* parent, const Weight* via,
+                                  const int* order, int reached, bool reverse) {
+    Edge* edges = new Edge[reached > 0 ? reached : 1];
+    int m = 0;
+    for (int i = 0; i < reached; ++i) {
+        int v = order[i];
+        if (parent[v] == -1) continue;
+        edges[m].src = reverse ? v : parent[v];
+        edges[m].dest = reverse ? parent[v] : v;
+        edges[m].weight = via[v];
+        m++;
+    }
+    DirectedGraph tree(n, edges, m);
+    delete[] edges;
+    return tree;
+}
+
+template<typename G>
+static DirectedGraph directedBfsTree(const G& g, int start, bool reverse) {
+    int n = g.getVertexCount();
+    checkStart(n, start);
+    int* parent = new int[n];
+    Weight* via = new Weight[n];
+    int* order = new int[n];
+    int reached = bfsParents(g, start, parent, via, order);
+    DirectedGraph tree = directedTree(n, parent, via, order, reached, reverse);
+    delete[] parent;
+    delete[] via;
+    delete[] order;
+    return tree;
+}
+
+// BFS: Breadth-First Search returning a BFS tree rooted at 'start'
+Graph Algorithms::bfs(const Graph& g, int start) {
+    return bfsTree(g, start);
+}
+
+Graph Algorithms::bfs(const CompressedGraph& g, int start) {
+    return bfsTree(g, start);
+}
+
+// DFS over any graph type exposing getVertexCount/getDegree/getMaxDegree/
+// copyNeighbors, with an explicit stack instead of recursion so deep graphs
+// (long paths) cannot overflow the call stack. The neighbor lists of the
+// vertices on the current path are stacked in one reused buffer, and each
+// path entry keeps a cursor into its own list, so a vertex resumes where it
+// stopped exactly like the return from a recursive call. The buffer holds
+// at most the degrees of one path and every list is copied once. Fills
+// parent/via (parent -1 for the start and unreached vertices) and the visit
+// order, and returns the number of vertices reached. The caller validates start.
+template<typename G>
+static int dfsParents(const G& g, int start, int* parent, Weight* via, int* order) {
+    int n = g.getVertexCount();
+    bool* visited = new bool[n]();
+    int* path = new int[n];
+    int* cursor = new int[n];   // Next list entry to scan, per path entry
+    int* listEnd = new int[n];  // End of the path entry's list in the buffer
+    int capacity = g.getMaxDegree() + 1;
+    Neighbor* buffer = new Neighbor[capacity];
+    for (int v = 0; v < n; ++v) parent[v] = -1;
+
+    int depth = 0, reached = 0;
+    int v = start;
+    while (true) {
+        // Visit v: push it on the path and stack its neighbor list
+        visited[v] = true;
+        order[reached++] = v;
+        int top = depth > 0 ? listEnd[depth - 1] : 0;
+        int degree = g.getDegree(v);
+        if (top + degree > capacity) {
+            capacity = top + degree > 2 * capacity ? top + degree : 2 * capacity;
+            Neighbor* grown = new Neighbor[capacity];
+            for (int i = 0; i < top; ++i) grown[i] = buffer[i];
+            delete[] buffer;
+            buffer = grown;
+        }
+        path[depth] = v;
+        cursor[depth] = top;
+        listEnd[depth] = top + g.copyNeighbors(v, buffer + top);
+        depth++;
+
+        // Advance the deepest path entry to its next unvisited neighbor
+        v = -1;
+        while (depth > 0 && v == -1) {
+            int d = depth - 1;
+            if (cursor[d] == listEnd[d]) {
+                depth--;
+                continue;
+            }
+            const Neighbor& next = buffer[cursor[d]++];
+            if (visited[next.vertex]) continue;
+            v = next.vertex;
+            parent[v] = path[d];
+            via[v] = next.weight;
         }
+        if (v == -1) break;
     }
-    delete[] neighbors;
+
+    delete[] visited;
+    delete[] path;
+    delete[] cursor;
+    delete[] listEnd;
+    delete[] buffer;
+    return reached;
 }
 
+// DFS: tree edges are added in discovery order
 Graph Algorithms::dfs(const Graph& g, int start) {
     int n = g.getVertexCount();
+    checkStart(n, start);
+    int* parent = new int[n];
+    Weight* via = new Weight[n];
+    int* order = new int[n];
+    int reached = dfsParents(g, start, parent, via, order);
     Graph tree(n);
-    bool* visited = new bool[n]();
-    dfs_visit(g, start, visited, tree);
-    delete[] visited;
+    for (int i = 1; i < reached; ++i) {
+        int v = order[i];
+        tree.addEdge(parent[v], v, via[v]);
+    }
+    delete[] parent;
+    delete[] via;
+    delete[] order;
     return tree;
 }
 
-// Dijkstra: Shortest path tree from 'start' using weights
-Graph Algorithms::dijkstra(const Graph& g, int start) {
+template<typename G>
+static DirectedGraph directedDfsTree(const G& g, int start, bool reverse) {
     int n = g.getVertexCount();
-    Graph tree(n);
-    int* dist = new int[n];
-    int* prev = new int[n];
+    checkStart(n, start);
+    int* parent = new int[n];
+    Weight* via = new Weight[n];
+    int* order = new int[n];
+    int reached = dfsParents(g, start, parent, via, order);
+
+    DirectedGraph tree = directedTree(n, parent, via, order, reached, reverse);
+    delete[] parent;
+    delete[] via;
+    delete[] order;
+    return tree;
+}
+
+// Dijkstra over any graph type exposing getVertexCount/getMaxDegree/copyNeighbors.
+// Path lengths are accumulated in Distance (wider than Weight by default), and a
+// 'reached' flag replaces an infinity sentinel so no type-specific maximum is needed.
+// The queue is indexed by vertex, so a relaxation of a queued vertex is a
+// decrease-key and the queue never holds more than n entries.
+// Fills prev/via (prev -1 for the start and unreached vertices) and dist
+// (defined for reached vertices only). The caller validates start. Returns
+// false if an edge leaving a reached vertex has a negative weight, in which
+// case the result is meaningless and the caller throws after cleaning up.
+template<typename G>
+static bool dijkstraParents(const G& g, int start, int* prev, Weight* via, Distance* dist) {
+    int n = g.getVertexCount();
+    bool* reached = new bool[n]();
+    bool* done = new bool[n]();
     for (int i = 0; i < n; ++i) {
-        dist[i] = INT_MAX;
         prev[i] = -1;
     }
     dist[start] = 0;
+    reached[start] = true;
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
 
-    PriorityQueue pq(n);
+    PriorityQueue pq(n, false, true);
     pq.insert(start, 0);
 
+    bool valid = true;
     while (!pq.isEmpty()) {
         int u = pq.extractMin();
-        int count;
-        Neighbor* neighbors = g.getNeighbors(u, count);
+        done[u] = true;
+        int count = g.copyNeighbors(u, neighbors);
         for (int i = 0; i < count; ++i) {
             int v = neighbors[i].vertex;
-            int w = neighbors[i].weight;
-            if (dist[u] + w < dist[v]) {
-                dist[v] = dist[u] + w;
+            Weight w = neighbors[i].weight;
+            if (isNegative(w)) valid = false;
+            Distance candidate = dist[u] + w;
+            if (!done[v] && (!reached[v] || candidate < dist[v])) {
+                reached[v] = true;
+                dist[v] = candidate;
                 prev[v] = u;
-                pq.insert(v, dist[v]);
+                via[v] = w;
+                if (pq.contains(v)) pq.changePriority(v, candidate);
+                else pq.insert(v, candidate);
             }
         }
-        delete[] neighbors;
+    }
+    delete[] neighbors;
+    delete[] reached;
+    delete[] done;
+    return valid;
+}
+
+template<typename G>
+static Graph dijkstraTree(const G& g, int start) {
+    int n = g.getVertexCount();
+    checkStart(n, start);
+    Distance* dist = new Distance[n];
+    int* prev = new int[n];
+    Weight* via = new Weight[n];
+    if (!dijkstraParents(g, start, prev, via, dist)) {
+        delete[] dist;
+        delete[] prev;
+        delete[] via;
+        throw GraphException("Edge weights must not be negative");
     }
 
+    Graph tree(n);
     for (int v = 0; v < n; ++v) {
         if (prev[v] != -1)
-            tree.addEdge(prev[v], v, dist[v] - dist[prev[v]]);
+            tree.addEdge(prev[v], v, via[v]);
     }
     delete[] dist;
     delete[] prev;
+    delete[] via;
     return tree;
 }
 
+template<typename G>
+static DirectedGraph directedDijkstraTree(const G& g, int start, bool reverse) {
+    int n = g.getVertexCount();
+    checkStart(n, start);
+    Distance* dist = new Distance[n];
+    int* prev = new int[n];
+    Weight* via = new Weight[n];
+    int* order = new int[n];
+    if (!dijkstraParents(g, start, prev, via, dist)) {
+        delete[] dist;
+        delete[] prev;
+        delete[] via;
+        delete[] order;
+        throw GraphException("Edge weights must not be negative");
+    }
+    for (int v = 0; v < n; ++v) order[v] = v;
+
+    DirectedGraph tree = directedTree(n, prev, via, order, n, reverse);
+    delete[] dist;
+    delete[] prev;
+    delete[] via;
+    delete[] order;
+    return tree;
+}
+
+// Dijkstra: Shortest path tree from 'start' using weights. With unit
+// weights a BFS tree is a shortest-path tree, so the priority queue is
+// skipped entirely (always the case in GRAPH_UNWEIGHTED builds).
+Graph Algorithms::dijkstra(const Graph& g, int start) {
+#ifdef GRAPH_UNWEIGHTED
+    return bfsTree(g, start);
+#else
+    if (g.isUnweighted()) return bfsTree(g, start);
+    return dijkstraTree(g, start);
+#endif
+}
+
+Graph Algorithms::dijkstra(const CompressedGraph& g, int start) {
+#ifdef GRAPH_UNWEIGHTED
+    return bfsTree(g, start);
+#else
+    if (g.hasUnitWeights()) return bfsTree(g, start);
+    return dijkstraTree(g, start);
+#endif
+}
+
+// Directed traversals: out-edges for the forward variants, in-edges
+// (through the InEdges view) for the reverse ones
+DirectedGraph Algorithms::bfs(const DirectedGraph& g, int start) {
+    return directedBfsTree(g, start, false);
+}
+
+DirectedGraph Algorithms::reverseBfs(const DirectedGraph& g, int target) {
+    InEdges in = {g};
+    return directedBfsTree(in, target, true);
+}
+
+DirectedGraph Algorithms::dfs(const DirectedGraph& g, int start) {
+    return directedDfsTree(g, start, false);
+}
+
+DirectedGraph Algorithms::reverseDfs(const DirectedGraph& g, int target) {
+    InEdges in = {g};
+    return directedDfsTree(in, target, true);
+}
+
+DirectedGraph Algorithms::dijkstra(const DirectedGraph& g, int start) {
+    if (g.isUnweighted()) return directedBfsTree(g, start, false);
+    return directedDijkstraTree(g, start, false);
+}
+
+DirectedGraph Algorithms::reverseDijkstra(const DirectedGraph& g, int target) {
+    InEdges in = {g};
+    if (g.isUnweighted()) return directedBfsTree(in, target, true);
+    return directedDijkstraTree(in, target, true);
+}
+
 // Prim: Minimum spanning tree using priority queue
 Graph Algorithms::prim(const Graph& g) {
     int n = g.getVertexCount();
     Graph tree(n);
+    if (n == 0) return tree;
     bool* inMST = new bool[n]();
-    int* key = new int[n];
+    bool* hasKey = new bool[n]();
+    Weight* key = new Weight[n];
     int* parent = new int[n];
     for (int i = 0; i < n; ++i) {
-        key[i] = INT_MAX;
         parent[i] = -1;
     }
     key[0] = 0;
+    hasKey[0] = true;
 
-    PriorityQueue pq(n);
+    // Indexed by vertex: a key improvement is a decrease-key, so at most n entries
+    PriorityQueue pq(n, false, true);
     pq.insert(0, 0);
 
     while (!pq.isEmpty()) {
@@ -130,11 +406,13 @@ Graph Algorithms::prim(const Graph& g) {
         Neighbor* neighbors = g.getNeighbors(u, count);
         for (int i = 0; i < count; ++i) {
             int v = neighbors[i].vertex;
-            int w = neighbors[i].weight;
-            if (!inMST[v] && w < key[v]) {
+            Weight w = neighbors[i].weight;
+            if (!inMST[v] && (!hasKey[v] || w < key[v])) {
                 key[v] = w;
+                hasKey[v] = true;
                 parent[v] = u;
-                pq.insert(v, key[v]);
+                if (pq.contains(v)) pq.changePriority(v, w);
+                else pq.insert(v, w);
             }
         }
         delete[] neighbors;
@@ -145,6 +423,7 @@ Graph Algorithms::prim(const Graph& g) {
             tree.addEdge(parent[v], v, key[v]);
     }
     delete[] inMST;
+    delete[] hasKey;
     delete[] key;
     delete[] parent;
     return tree;
@@ -158,7 +437,8 @@ Graph Algorithms::kruskal(const Graph& g) {
 
     // Collect all edges manually (no STL vector)
     struct Edge {
-        int w, u, v;
+        Weight w;
+        int u, v;
     } edges[500]; // assuming at most 500 edges
     int edgeCount = 0;
 
@@ -167,7 +447,7 @@ Graph Algorithms::kruskal(const Graph& g) {
         Neighbor* neighbors = g.getNeighbors(u, count);
         for (int i = 0; i < count; ++i) {
             int v = neighbors[i].vertex;
-            int w = neighbors[i].weight;
+            Weight w = neighbors[i].weight;
             if (u < v) {
                 edges[edgeCount++] = {w, u, v};
             }
@@ -189,7 +469,7 @@ Graph Algorithms::kruskal(const Graph& g) {
     for (int i = 0; i < edgeCount; ++i) {
         int u = edges[i].u;
         int v = edges[i].v;
-        int w = edges[i].w;
+        Weight w = edges[i].w;
         if (uf.find(u) != uf.find(v)) {
             tree.addEdge(u, v, w);
             uf.unite(u, v);
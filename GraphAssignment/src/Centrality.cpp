@@ -0,0 +1,510 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Centrality.h"
+#include "Graph.h"
+#include "DirectedGraph.h"
+#include "GraphException.h"
+#include "data_structures/PriorityQueue.h"
+#include <cmath>
+
+namespace graph {
+
+// Sources are grouped into segments of 2^SEGMENT_BITS vertex IDs, so the
+// contributions read while processing one segment (256 KiB of doubles) stay
+// in the L2 cache.
+static const int SEGMENT_BITS = 15;
+
+// In-edges of v: the neighbors for an undirected graph, the in-adjacency for a directed one
+static int inNeighbors(const Graph& g, int v, Neighbor* out) {
+    return g.copyNeighbors(v, out);
+}
+
+static int inNeighbors(const DirectedGraph& g, int v, Neighbor* out) {
+    return g.copyInNeighbors(v, out);
+}
+
+static int maxInDegree(const Graph& g) {
+    return g.getMaxDegree();
+}
+
+static int maxInDegree(const DirectedGraph& g) {
+    return g.getMaxInDegree();
+}
+
+// Segmented pull CSR: for segment s, entries segBegin[s] .. segBegin[s+1]
+// list each destination with at least one source in s; the sources of
+// entry e are srcs[destStart[e] .. destStart[e+1]).
+struct PullGraph {
+    int n;
+    int segments;
+    int* segBegin;
+    int* dests;
+    int* destStart;
+    int* srcs;
+    double* weights;    // Edge weights, or nullptr for unit transitions
+    double* outWeight;  // Out-degree or total out-weight of every vertex
+
+    PullGraph()
+        : n(0), segments(0), segBegin(nullptr), dests(nullptr), destStart(nullptr),
+          srcs(nullptr), weights(nullptr), outWeight(nullptr) {}
+    ~PullGraph() {
+        delete[] segBegin;
+        delete[] dests;
+        delete[] destStart;
+        delete[] srcs;
+        delete[] weights;
+        delete[] outWeight;
+    }
+    PullGraph(const PullGraph&) = delete;
+    PullGraph& operator=(const PullGraph&) = delete;
+};
+
+/**
+ * @brief Build the segmented pull CSR
+ *
+ * @details Two passes over the in-edges of every destination in ID order.
+ * The first counts, per segment, the edges and the distinct destinations
+ * (lastDest detects the first edge of a destination in a segment) and
+ * accumulates the out-weight of every source. The second scatters the edges
+ * to their segment. Since all in-edges of one destination are handled
+ * together, each entry's sources are contiguous and consecutive entries
+ * share boundaries, so destStart needs only one extra element in total.
+ */
+template<typename G>
+static void buildPull(PullGraph& pg, const G& g, bool weighted) {
+    int n = g.getVertexCount();
+    pg.n = n;
+    pg.segments = (n + (1 << SEGMENT_BITS) - 1) >> SEGMENT_BITS;
+    int segments = pg.segments;
+    pg.outWeight = new double[n > 0 ? n : 1]();
+    pg.segBegin = new int[segments + 1]();
+    int* edgeBegin = new int[segments + 1]();
+    int* lastDest = new int[segments > 0 ? segments : 1];
+    Neighbor* neighbors = new Neighbor[maxInDegree(g) + 1];
+
+    for (int s = 0; s < segments; ++s) lastDest[s] = -1;
+    for (int v = 0; v < n; ++v) {
+        int count = inNeighbors(g, v, neighbors);
+        for (int i = 0; i < count; ++i) {
+            int u = neighbors[i].vertex;
+            int s = u >> SEGMENT_BITS;
+            if (weighted && isNegative(neighbors[i].weight)) {
+                delete[] edgeBegin;
+                delete[] lastDest;
+                delete[] neighbors;
+                throw GraphException("Edge weights must not be negative");
+            }
+            if (lastDest[s] != v) {
+                lastDest[s] = v;
+                pg.segBegin[s + 1]++;
+            }
+            edgeBegin[s + 1]++;
+            pg.outWeight[u] += weighted ? static_cast<double>(neighbors[i].weight) : 1.0;
+        }
+    }
+    for (int s = 0; s < segments; ++s) {
+        pg.segBegin[s + 1] += pg.segBegin[s];
+        edgeBegin[s + 1] += edgeBegin[s];
+    }
+
+    int totalDests = pg.segBegin[segments];
+    int totalEdges = edgeBegin[segments];
+    pg.dests = new int[totalDests > 0 ? totalDests : 1];
+    pg.destStart = new int[totalDests + 1];
+    pg.srcs = new int[totalEdges > 0 ? totalEdges : 1];
+    if (weighted) pg.weights = new double[totalEdges > 0 ? totalEdges : 1];
+    int* destPos = new int[segments > 0 ? segments : 1];
+    for (int s = 0; s < segments; ++s) {
+        lastDest[s] = -1;
+        destPos[s] = pg.segBegin[s];
+    }
+
+    for (int v = 0; v < n; ++v) {
+        int count = inNeighbors(g, v, neighbors);
+        for (int i = 0; i < count; ++i) {
+            int u = neighbors[i].vertex;
+            int s = u >> SEGMENT_BITS;
+            if (lastDest[s] != v) {
+                lastDest[s] = v;
+                int e = destPos[s]++;
+                pg.dests[e] = v;
+                pg.destStart[e] = edgeBegin[s];
+            }
+            pg.srcs[edgeBegin[s]] = u;
+            if (weighted) pg.weights[edgeBegin[s]] = static_cast<double>(neighbors[i].weight);
+            edgeBegin[s]++;
+        }
+    }
+    pg.destStart[totalDests] = totalEdges;
+
+    delete[] edgeBegin;
+    delete[] lastDest;
+    delete[] destPos;
+    delete[] neighbors;
+}
+
+static void checkParameters(double damping, int maxIterations) {
+    if (damping < 0.0 || damping > 1.0)
+        throw GraphException("Damping factor must be in [0, 1]");
+    if (maxIterations < 0)
+        throw GraphException("Iteration count must not be negative");
+}
+
+/**
+ * @brief Power iteration with double buffering
+ *
+ * @details Each iteration first turns ranks into per-source contributions
+ * rank(u) / W(u), collecting the rank of sources without out-edges, then
+ * pulls the contributions segment by segment into acc. Within a segment
+ * every destination has one entry, so the entries are processed in parallel
+ * without atomics. The new ranks are written to the second buffer and the
+ * buffers are swapped.
+ */
+static double* iterate(const PullGraph& pg, const double* teleport, double damping,
+                       double tolerance, int maxIterations) {
+    int n = pg.n;
+    double* rank = new double[n > 0 ? n : 1];
+    double* next = new double[n > 0 ? n : 1];
+    double* contrib = new double[n > 0 ? n : 1];
+    double* acc = new double[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) rank[v] = teleport[v];
+
+    for (int it = 0; it < maxIterations; ++it) {
+        double dangling = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : dangling)
+#endif
+        for (int u = 0; u < n; ++u) {
+            if (pg.outWeight[u] > 0.0) {
+                contrib[u] = rank[u] / pg.outWeight[u];
+            } else {
+                contrib[u] = 0.0;
+                dangling += rank[u];
+            }
+            acc[u] = 0.0;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        for (int s = 0; s < pg.segments; ++s) {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 512)
+#endif
+            for (int e = pg.segBegin[s]; e < pg.segBegin[s + 1]; ++e) {
+                double sum = 0.0;
+                if (pg.weights) {
+                    for (int j = pg.destStart[e]; j < pg.destStart[e + 1]; ++j)
+                        sum += pg.weights[j] * contrib[pg.srcs[j]];
+                } else {
+                    for (int j = pg.destStart[e]; j < pg.destStart[e + 1]; ++j)
+                        sum += contrib[pg.srcs[j]];
+                }
+                acc[pg.dests[e]] += sum;
+            }
+        }
+
+        double jump = 1.0 - damping + damping * dangling;
+        double change = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : change)
+#endif
+        for (int v = 0; v < n; ++v) {
+            next[v] = jump * teleport[v] + damping * acc[v];
+            double delta = next[v] - rank[v];
+            change += delta < 0 ? -delta : delta;
+        }
+        swap(rank, next);
+        if (change < tolerance) break;
+    }
+
+    delete[] next;
+    delete[] contrib;
+    delete[] acc;
+    return rank;
+}
+
+// Uniform teleport over the active vertices
+static double* uniformTeleport(const Graph& g) {
+    int n = g.getVertexCount();
+    int active = g.getActiveVertexCount();
+    double* teleport = new double[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) {
+        teleport[v] = g.hasVertex(v) ? 1.0 / active : 0.0;
+    }
+    return teleport;
+}
+
+double* Centrality::pageRank(const Graph& g, double damping, double tolerance, int maxIterations) {
+    checkParameters(damping, maxIterations);
+    PullGraph pg;
+    buildPull(pg, g, false);
+    double* teleport = uniformTeleport(g);
+    double* rank = iterate(pg, teleport, damping, tolerance, maxIterations);
+    delete[] teleport;
+    return rank;
+}
+
+double* Centrality::pageRank(const DirectedGraph& g, double damping, double tolerance,
+                             int maxIterations) {
+    checkParameters(damping, maxIterations);
+    PullGraph pg;
+    buildPull(pg, g, false);
+    int n = g.getVertexCount();
+    double* teleport = new double[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) teleport[v] = 1.0 / n;
+    double* rank = iterate(pg, teleport, damping, tolerance, maxIterations);
+    delete[] teleport;
+    return rank;
+}
+
+double* Centrality::personalizedPageRank(const Graph& g, const double* teleport, double damping,
+                                         double tolerance, int maxIterations) {
+    checkParameters(damping, maxIterations);
+    int n = g.getVertexCount();
+    if (n > 0 && teleport == nullptr)
+        throw GraphException("Teleport weights must not sum to zero");
+    double total = 0.0;
+    for (int v = 0; v < n; ++v) {
+        if (teleport[v] < 0.0)
+            throw GraphException("Teleport weights must not be negative");
+        if (g.hasVertex(v)) total += teleport[v];
+    }
+    if (total <= 0.0)
+        throw GraphException("Teleport weights must not sum to zero");
+
+    PullGraph pg;
+    buildPull(pg, g, false);
+    double* normalized = new double[n];
+    for (int v = 0; v < n; ++v) {
+        normalized[v] = g.hasVertex(v) ? teleport[v] / total : 0.0;
+    }
+    double* rank = iterate(pg, normalized, damping, tolerance, maxIterations);
+    delete[] normalized;
+    return rank;
+}
+
+double* Centrality::weightedPageRank(const Graph& g, double damping, double tolerance,
+                                     int maxIterations) {
+    checkParameters(damping, maxIterations);
+    PullGraph pg;
+    buildPull(pg, g, true);
+    double* teleport = uniformTeleport(g);
+    double* rank = iterate(pg, teleport, damping, tolerance, maxIterations);
+    delete[] teleport;
+    return rank;
+}
+
+// Scratch arrays of one Brandes search; one workspace per thread
+struct BrandesWorkspace {
+    Distance* dist;
+    double* sigma;     // Number of shortest paths from the source
+    double* delta;     // Dependency of the source on each vertex
+    bool* reached;
+    bool* settled;
+    int* order;        // Vertices in non-decreasing distance
+    Neighbor* neighbors;
+    PriorityQueue* pq; // Only for weighted searches
+
+    BrandesWorkspace(int n, int maxDegree, bool weighted)
+        : dist(new Distance[n]), sigma(new double[n]()), delta(new double[n]()),
+          reached(new bool[n]()), settled(new bool[n]()), order(new int[n]),
+          neighbors(new Neighbor[maxDegree + 1]),
+          pq(weighted ? new PriorityQueue(n, false, true) : nullptr) {}
+    ~BrandesWorkspace() {
+        delete[] dist;
+        delete[] sigma;
+        delete[] delta;
+        delete[] reached;
+        delete[] settled;
+        delete[] order;
+        delete[] neighbors;
+        delete pq;
+    }
+    BrandesWorkspace(const BrandesWorkspace&) = delete;
+    BrandesWorkspace& operator=(const BrandesWorkspace&) = delete;
+};
+
+/**
+ * @brief Add the dependencies of one source to the scores
+ *
+ * @details The forward search counts shortest paths: a vertex's count is
+ * final when it leaves the queue, because all its predecessors are strictly
+ * closer. The backward pass visits vertices farthest first and pushes
+ * delta(w) to every predecessor v (dist[v] + w(v, w) == dist[w]) in
+ * proportion sigma[v] / sigma[w]. Only the reached vertices are reset
+ * afterwards, so a search from a small component costs only its size.
+ */
+static void brandesSource(const Graph& g, int s, BrandesWorkspace& ws, double* scores) {
+    int count = 0;
+    ws.dist[s] = 0;
+    ws.sigma[s] = 1.0;
+    ws.reached[s] = true;
+
+    if (!ws.pq) {
+        ws.order[count++] = s;
+        for (int head = 0; head < count; ++head) {
+            int v = ws.order[head];
+            int degree = g.copyNeighbors(v, ws.neighbors);
+            for (int i = 0; i < degree; ++i) {
+                int w = ws.neighbors[i].vertex;
+                if (!ws.reached[w]) {
+                    ws.reached[w] = true;
+                    ws.dist[w] = ws.dist[v] + 1;
+                    ws.order[count++] = w;
+                }
+                if (ws.dist[w] == ws.dist[v] + 1) ws.sigma[w] += ws.sigma[v];
+            }
+        }
+    } else {
+        ws.pq->insert(s, 0);
+        while (!ws.pq->isEmpty()) {
+            int v = ws.pq->extractMin();
+            ws.settled[v] = true;
+            ws.order[count++] = v;
+            int degree = g.copyNeighbors(v, ws.neighbors);
+            for (int i = 0; i < degree; ++i) {
+                int w = ws.neighbors[i].vertex;
+                Distance candidate = ws.dist[v] + ws.neighbors[i].weight;
+                if (ws.settled[w]) continue;
+                if (!ws.reached[w] || candidate < ws.dist[w]) {
+                    ws.reached[w] = true;
+                    ws.dist[w] = candidate;
+                    ws.sigma[w] = ws.sigma[v];
+                    if (ws.pq->contains(w)) ws.pq->changePriority(w, candidate);
+                    else ws.pq->insert(w, candidate);
+                } else if (candidate == ws.dist[w]) {
+                    ws.sigma[w] += ws.sigma[v];
+                }
+            }
+        }
+    }
+
+    for (int i = count - 1; i > 0; --i) {
+        int w = ws.order[i];
+        double share = (1.0 + ws.delta[w]) / ws.sigma[w];
+        int degree = g.copyNeighbors(w, ws.neighbors);
+        for (int j = 0; j < degree; ++j) {
+            int v = ws.neighbors[j].vertex;
+            Weight weight = ws.pq ? ws.neighbors[j].weight : 1;
+            if (ws.reached[v] && ws.dist[v] + weight == ws.dist[w])
+                ws.delta[v] += ws.sigma[v] * share;
+        }
+        scores[w] += ws.delta[w];
+    }
+
+    for (int i = 0; i < count; ++i) {
+        int v = ws.order[i];
+        ws.sigma[v] = 0.0;
+        ws.delta[v] = 0.0;
+        ws.reached[v] = false;
+        ws.settled[v] = false;
+    }
+}
+
+// Dijkstra-based counting needs strictly positive weights
+static void checkBrandesWeights(const Graph& g) {
+    if (g.isUnweighted()) return;
+    int n = g.getVertexCount();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    for (int v = 0; v < n; ++v) {
+        int degree = g.copyNeighbors(v, neighbors);
+        for (int i = 0; i < degree; ++i) {
+            if (neighbors[i].weight <= 0) {
+                delete[] neighbors;
+                throw GraphException("Edge weights must be positive");
+            }
+        }
+    }
+    delete[] neighbors;
+}
+
+// Runs brandesSource from every listed source in parallel; per-thread
+// score arrays are summed once at the end.
+static double* brandes(const Graph& g, const int* sources, int count, double scale) {
+    int n = g.getVertexCount();
+    bool weighted = !g.isUnweighted();
+    int maxDegree = g.getMaxDegree();
+
+    double* scores = new double[n > 0 ? n : 1]();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        BrandesWorkspace ws(n > 0 ? n : 1, maxDegree, weighted);
+        double* local = new double[n > 0 ? n : 1]();
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (int i = 0; i < count; ++i) {
+            brandesSource(g, sources[i], ws, local);
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        for (int v = 0; v < n; ++v) {
+            scores[v] += local[v];
+        }
+        delete[] local;
+    }
+
+    for (int v = 0; v < n; ++v) {
+        scores[v] *= scale;
+    }
+    return scores;
+}
+
+static int* activeVertices(const Graph& g, int& count) {
+    int n = g.getVertexCount();
+    int* vertices = new int[n > 0 ? n : 1];
+    count = 0;
+    for (int v = 0; v < n; ++v) {
+        if (g.hasVertex(v)) vertices[count++] = v;
+    }
+    return vertices;
+}
+
+// Every unordered pair is reached from both of its endpoints, hence the 1/2
+double* Centrality::betweenness(const Graph& g) {
+    checkBrandesWeights(g);
+    int count;
+    int* sources = activeVertices(g, count);
+    double* scores = brandes(g, sources, count, 0.5);
+    delete[] sources;
+    return scores;
+}
+
+// Sources drawn without replacement by a partial Fisher-Yates shuffle
+// driven by a xorshift generator
+double* Centrality::approximateBetweenness(const Graph& g, int samples, unsigned int seed) {
+    if (samples <= 0)
+        throw GraphException("Sample count must be positive");
+    checkBrandesWeights(g);
+    int count;
+    int* sources = activeVertices(g, count);
+    if (samples > count) samples = count;
+    unsigned int state = seed ? seed : 1;
+    for (int i = 0; i < samples; ++i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        int j = i + static_cast<int>(state % static_cast<unsigned int>(count - i));
+        swap(sources[i], sources[j]);
+    }
+    double* scores = brandes(g, sources, samples, samples > 0 ? 0.5 * count / samples : 0.0);
+    delete[] sources;
+    return scores;
+}
+
+double Centrality::betweennessErrorBound(int vertices, int samples, double failureProbability) {
+    if (samples <= 0)
+        throw GraphException("Sample count must be positive");
+    if (failureProbability <= 0.0 || failureProbability >= 1.0)
+        throw GraphException("Failure probability must be in (0, 1)");
+    if (vertices < 3) return 0.0;
+    double range = 0.5 * vertices * (vertices - 2.0);
+    return range * std::sqrt(std::log(2.0 * vertices / failureProbability) / (2.0 * samples));
+}
+
+} // namespace graph
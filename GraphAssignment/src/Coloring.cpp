@@ -0,0 +1,456 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Coloring.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+
+namespace graph {
+
+/**
+ * @brief CSR snapshot of a graph without self-loops
+ *
+ * @details The neighbors of u are targets[offsets[u] .. offsets[u+1]), and
+ * maxDegree is the largest row length, so greedy colors stay below
+ * maxDegree + 1.
+ */
+struct ColorAdjacency : CsrSnapshot {
+    explicit ColorAdjacency(const Graph& g) : CsrSnapshot(g, false, true) {}
+};
+
+/**
+ * @brief Smallest color not used by the colored neighbors of v
+ *
+ * @details forbidden[c] == v marks color c as taken for v, so the array
+ * never needs clearing between vertices. Uncolored neighbors have color -1.
+ */
+static int firstFreeColor(const ColorAdjacency& a, const int* color, int v, int* forbidden) {
+    for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+        int c = color[a.targets[j]];
+        if (c >= 0) forbidden[c] = v;
+    }
+    int c = 0;
+    while (forbidden[c] == v) c++;
+    return c;
+}
+
+// Color the vertices greedily in the given order; returns the number of colors
+static int colorInOrder(const ColorAdjacency& a, const int* order, int* color) {
+    int* forbidden = new int[a.maxDegree + 1];
+    for (int c = 0; c <= a.maxDegree; ++c) forbidden[c] = -1;
+    for (int v = 0; v < a.n; ++v) color[v] = -1;
+    int colors = a.n > 0 ? 1 : 0;
+    for (int i = 0; i < a.n; ++i) {
+        int v = order[i];
+        color[v] = firstFreeColor(a, color, v, forbidden);
+        if (color[v] + 1 > colors) colors = color[v] + 1;
+    }
+    delete[] forbidden;
+    return colors;
+}
+
+int* Coloring::largestFirst(const Graph& g, int& colors) {
+    ColorAdjacency a(g);
+    int n = a.n;
+    // Counting sort by decreasing degree, stable in ID
+    int* start = new int[a.maxDegree + 2]();
+    for (int v = 0; v < n; ++v) start[a.maxDegree - (a.offsets[v + 1] - a.offsets[v]) + 1]++;
+    for (int d = 0; d <= a.maxDegree; ++d) start[d + 1] += start[d];
+    int* order = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) order[start[a.maxDegree - (a.offsets[v + 1] - a.offsets[v])]++] = v;
+    delete[] start;
+
+    int* color = new int[n > 0 ? n : 1];
+    colors = colorInOrder(a, order, color);
+    delete[] order;
+    return color;
+}
+
+/**
+ * @brief Smallest-last order by Batagelj-Zaversnik bucket peeling
+ *
+ * @details Same bucket structure as Cores::coreNumbers(): vert is kept
+ * sorted by remaining degree and processed in order, which removes a
+ * minimum-degree vertex at every step. Coloring runs over vert backwards.
+ */
+int* Coloring::smallestLast(const Graph& g, int& colors) {
+    ColorAdjacency a(g);
+    int n = a.n;
+    int* deg = new int[n > 0 ? n : 1];
+    int* bin = new int[a.maxDegree + 1]();
+    int* pos = new int[n > 0 ? n : 1];
+    int* vert = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) {
+        deg[v] = a.offsets[v + 1] - a.offsets[v];
+        bin[deg[v]]++;
+    }
+    int start = 0;
+    for (int d = 0; d <= a.maxDegree; ++d) {
+        int size = bin[d];
+        bin[d] = start;
+        start += size;
+    }
+    for (int v = 0; v < n; ++v) {
+        pos[v] = bin[deg[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = a.maxDegree; d > 0; --d) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+
+    for (int i = 0; i < n; ++i) {
+        int v = vert[i];
+        for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+            int u = a.targets[j];
+            if (deg[u] > deg[v]) {
+                int du = deg[u];
+                int pu = pos[u];
+                int pw = bin[du];
+                int w = vert[pw];
+                if (u != w) {
+                    pos[u] = pw;
+                    vert[pu] = w;
+                    pos[w] = pu;
+                    vert[pw] = u;
+                }
+                bin[du]++;
+                deg[u]--;
+            }
+        }
+    }
+    for (int i = 0, j = n - 1; i < j; ++i, --j) swap(vert[i], vert[j]);
+
+    int* color = new int[n > 0 ? n : 1];
+    colors = colorInOrder(a, vert, color);
+    delete[] deg;
+    delete[] bin;
+    delete[] pos;
+    delete[] vert;
+    return color;
+}
+
+// Pseudo-random priority of v; ties are broken by ID in precedes()
+static inline unsigned colorPriority(int v, unsigned seed) {
+    unsigned h = static_cast<unsigned>(v) * 0x9E3779B1u + seed * 0x85EBCA77u;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    h *= 0x846CA68Bu;
+    return h ^ (h >> 16);
+}
+
+static inline bool precedes(const unsigned* priority, int u, int v) {
+    return priority[u] > priority[v] || (priority[u] == priority[v] && u < v);
+}
+
+/**
+ * @brief Jones-Plassmann rounds driven by predecessor counts
+ *
+ * @details waiting[v] counts the arcs from v to higher-priority neighbors.
+ * A round colors its frontier, whose members all have waiting 0, and then
+ * decrements the counts of their lower-priority neighbors; the thread whose
+ * decrement reaches 0 appends that neighbor to the next frontier. A
+ * frontier vertex only reads colors of higher-priority neighbors, all set
+ * in earlier rounds, so the outcome is the same for any schedule.
+ */
+int* Coloring::jonesPlassmann(const Graph& g, int& colors, unsigned int seed) {
+    ColorAdjacency a(g);
+    int n = a.n;
+    unsigned* priority = new unsigned[n > 0 ? n : 1];
+    int* waiting = new int[n > 0 ? n : 1];
+    int* frontier = new int[n > 0 ? n : 1];
+    int* next = new int[n > 0 ? n : 1];
+    int* color = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) priority[v] = colorPriority(v, seed);
+
+    int frontierSize = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < n; ++v) {
+        color[v] = -1;
+        int count = 0;
+        for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+            if (precedes(priority, a.targets[j], v)) count++;
+        }
+        waiting[v] = count;
+        if (count == 0) {
+            int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            slot = frontierSize++;
+            frontier[slot] = v;
+        }
+    }
+
+    while (frontierSize > 0) {
+        int nextSize = 0;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int* forbidden = new int[a.maxDegree + 1];
+            for (int c = 0; c <= a.maxDegree; ++c) forbidden[c] = -1;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+            for (int i = 0; i < frontierSize; ++i) {
+                int v = frontier[i];
+                color[v] = firstFreeColor(a, color, v, forbidden);
+                for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+                    int u = a.targets[j];
+                    if (!precedes(priority, v, u)) continue;
+                    int left;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                    left = --waiting[u];
+                    if (left == 0) {
+                        int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                        slot = nextSize++;
+                        next[slot] = u;
+                    }
+                }
+            }
+            delete[] forbidden;
+        }
+        swap(frontier, next);
+        frontierSize = nextSize;
+    }
+
+    colors = 0;
+    for (int v = 0; v < n; ++v) {
+        if (color[v] + 1 > colors) colors = color[v] + 1;
+    }
+    delete[] priority;
+    delete[] waiting;
+    delete[] frontier;
+    delete[] next;
+    return color;
+}
+
+/**
+ * @brief Speculative coloring with conflict rounds
+ *
+ * @details Each round first colors the worklist in parallel; colors are
+ * read and written with atomic accesses so that concurrent updates are
+ * well defined, and a vertex may see a neighbor's color from before or
+ * after that neighbor's update. A second parallel pass then keeps in the
+ * worklist each vertex that shares its color with a smaller neighbor. The
+ * smallest vertex of any conflict keeps its color, so every round settles
+ * at least one vertex and the loop terminates.
+ */
+int* Coloring::speculative(const Graph& g, int& colors) {
+    ColorAdjacency a(g);
+    int n = a.n;
+    int* color = new int[n > 0 ? n : 1];
+    int* work = new int[n > 0 ? n : 1];
+    int* conflicts = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) {
+        color[v] = -1;
+        work[v] = v;
+    }
+
+    int workSize = n;
+    while (workSize > 0) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int* forbidden = new int[a.maxDegree + 1];
+            for (int c = 0; c <= a.maxDegree; ++c) forbidden[c] = -1;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+            for (int i = 0; i < workSize; ++i) {
+                int v = work[i];
+                for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+                    int c;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                    c = color[a.targets[j]];
+                    if (c >= 0) forbidden[c] = v;
+                }
+                int c = 0;
+                while (forbidden[c] == v) c++;
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                color[v] = c;
+            }
+            delete[] forbidden;
+        }
+
+        int conflictCount = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for (int i = 0; i < workSize; ++i) {
+            int v = work[i];
+            for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+                int u = a.targets[j];
+                if (u < v && color[u] == color[v]) {
+                    int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                    slot = conflictCount++;
+                    conflicts[slot] = v;
+                    break;
+                }
+            }
+        }
+        swap(work, conflicts);
+        workSize = conflictCount;
+    }
+
+    colors = 0;
+    for (int v = 0; v < n; ++v) {
+        if (color[v] + 1 > colors) colors = color[v] + 1;
+    }
+    delete[] work;
+    delete[] conflicts;
+    return color;
+}
+
+bool* Coloring::maximalIndependentSet(const Graph& g, int& size) {
+    ColorAdjacency a(g);
+    int n = a.n;
+    bool* member = new bool[n > 0 ? n : 1];
+    bool* blocked = new bool[n > 0 ? n : 1]();
+    size = 0;
+    for (int v = 0; v < n; ++v) {
+        member[v] = !blocked[v];
+        if (!member[v]) continue;
+        size++;
+        for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) blocked[a.targets[j]] = true;
+    }
+    delete[] blocked;
+    return member;
+}
+
+/**
+ * @brief One bit per vertex, with atomic set for concurrent writers
+ */
+struct VertexBitmap {
+    unsigned long long* words;
+
+    explicit VertexBitmap(int n) : words(new unsigned long long[n / 64 + 1]()) {}
+    ~VertexBitmap() { delete[] words; }
+    VertexBitmap(const VertexBitmap&) = delete;
+    VertexBitmap& operator=(const VertexBitmap&) = delete;
+
+    bool test(int v) const {
+        return (words[v >> 6] >> (v & 63)) & 1ULL;
+    }
+    void set(int v) {
+        unsigned long long bit = 1ULL << (v & 63);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        words[v >> 6] |= bit;
+    }
+};
+
+/**
+ * @brief Luby rounds with fixed priorities
+ *
+ * @details Each round has three parallel passes over the undecided
+ * vertices: select the local priority maxima into 'joined' (reading only
+ * 'decided', which this pass does not change), mark them and their
+ * neighbors in 'decided', and compact the still undecided vertices into the
+ * next worklist. Selected vertices are never adjacent, since of two
+ * undecided neighbors only the higher-priority one can be a local maximum,
+ * so the outcome matches the sequential greedy order.
+ */
+bool* Coloring::maximalIndependentSetParallel(const Graph& g, int& size, unsigned int seed) {
+    ColorAdjacency a(g);
+    int n = a.n;
+    unsigned* priority = new unsigned[n > 0 ? n : 1];
+    int* work = new int[n > 0 ? n : 1];
+    int* next = new int[n > 0 ? n : 1];
+    VertexBitmap joined(n);
+    VertexBitmap decided(n);
+    for (int v = 0; v < n; ++v) {
+        priority[v] = colorPriority(v, seed);
+        work[v] = v;
+    }
+
+    int workSize = n;
+    while (workSize > 0) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for (int i = 0; i < workSize; ++i) {
+            int v = work[i];
+            bool maximum = true;
+            for (int j = a.offsets[v]; j < a.offsets[v + 1] && maximum; ++j) {
+                int u = a.targets[j];
+                if (!decided.test(u) && precedes(priority, u, v)) maximum = false;
+            }
+            if (maximum) joined.set(v);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+        for (int i = 0; i < workSize; ++i) {
+            int v = work[i];
+            if (!joined.test(v)) continue;
+            decided.set(v);
+            for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) decided.set(a.targets[j]);
+        }
+
+        int nextSize = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = 0; i < workSize; ++i) {
+            int v = work[i];
+            if (decided.test(v)) continue;
+            int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+            slot = nextSize++;
+            next[slot] = v;
+        }
+        swap(work, next);
+        workSize = nextSize;
+    }
+
+    bool* member = new bool[n > 0 ? n : 1];
+    size = 0;
+    for (int v = 0; v < n; ++v) {
+        member[v] = joined.test(v);
+        if (member[v]) size++;
+    }
+    delete[] priority;
+    delete[] work;
+    delete[] next;
+    return member;
+}
+
+bool Coloring::isProper(const Graph& g, const int* color) {
+    int n = g.getVertexCount();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    bool proper = true;
+    for (int u = 0; u < n && proper; ++u) {
+        int count = g.copyNeighbors(u, neighbors);
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            if (v != u && color[v] == color[u]) proper = false;
+        }
+    }
+    delete[] neighbors;
+    return proper;
+}
+
+} // namespace graph
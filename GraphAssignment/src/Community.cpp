@@ -0,0 +1,616 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Community.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace graph {
+
+// Local moving stops after this many passes over a level, or earlier once a
+// pass improves the modularity by less than MOVE_TOLERANCE.
+static const int MAX_PASSES = 32;
+static const double MOVE_TOLERANCE = 1e-7;
+
+/**
+ * @brief Weighted CSR graph of one Louvain level
+ *
+ * @details Level 0 is a snapshot of the input, in which a self-loop is
+ * listed twice like in Graph. On aggregated levels, vertex c stands for a
+ * set of vertices and has one self-loop whose weight is the internal weight
+ * of the set, counted at both endpoints. degree[v] is the sum of the weights
+ * of v's arcs, self-loops included, and total the sum of all degrees (2m).
+ */
+struct CommunityLevel {
+    int n;
+    int* offsets;
+    int* targets;
+    double* weights;
+    double* degree;
+    double total;
+
+    CommunityLevel()
+        : n(0), offsets(nullptr), targets(nullptr), weights(nullptr), degree(nullptr), total(0.0) {}
+    ~CommunityLevel() {
+        delete[] offsets;
+        delete[] targets;
+        delete[] weights;
+        delete[] degree;
+    }
+    CommunityLevel(const CommunityLevel&) = delete;
+    CommunityLevel& operator=(const CommunityLevel&) = delete;
+
+    void exchange(CommunityLevel& other) {
+        swap(n, other.n);
+        swap(offsets, other.offsets);
+        swap(targets, other.targets);
+        swap(weights, other.weights);
+        swap(degree, other.degree);
+        swap(total, other.total);
+    }
+
+    void computeDegrees() {
+        degree = new double[n > 0 ? n : 1];
+        total = 0.0;
+        for (int v = 0; v < n; ++v) {
+            double sum = 0.0;
+            for (int j = offsets[v]; j < offsets[v + 1]; ++j) sum += weights[j];
+            degree[v] = sum;
+            total += sum;
+        }
+    }
+};
+
+/**
+ * @brief Sparse accumulator of the weight from one vertex to each community
+ *
+ * @details weightTo is -1 for communities not seen yet, so zero-weight
+ * edges are still recorded once in touched.
+ */
+struct NeighborCommunities {
+    double* weightTo;
+    int* touched;
+    int count;
+
+    explicit NeighborCommunities(int n)
+        : weightTo(new double[n > 0 ? n : 1]), touched(new int[n > 0 ? n : 1]), count(0) {
+        for (int c = 0; c < n; ++c) weightTo[c] = -1.0;
+    }
+    ~NeighborCommunities() {
+        delete[] weightTo;
+        delete[] touched;
+    }
+    NeighborCommunities(const NeighborCommunities&) = delete;
+    NeighborCommunities& operator=(const NeighborCommunities&) = delete;
+
+    void add(int c, double w) {
+        if (weightTo[c] < 0.0) {
+            weightTo[c] = 0.0;
+            touched[count++] = c;
+        }
+        weightTo[c] += w;
+    }
+    double weightOf(int c) const {
+        return weightTo[c] < 0.0 ? 0.0 : weightTo[c];
+    }
+    void clear() {
+        for (int i = 0; i < count; ++i) weightTo[touched[i]] = -1.0;
+        count = 0;
+    }
+};
+
+/**
+ * @brief One NeighborCommunities per thread, reused across passes
+ *
+ * @details Every accumulator is empty again after clear(), so one set of
+ * them serves all passes, iterations and levels of a run (levels only
+ * shrink). Each thread creates its own on first use, so the O(n) fill
+ * happens once per thread and on memory that thread touches first.
+ */
+struct ThreadAccumulators {
+    int n;
+    int threads;
+    NeighborCommunities** near;
+
+    explicit ThreadAccumulators(int n) : n(n), threads(1), near(nullptr) {
+#ifdef _OPENMP
+        threads = omp_get_max_threads();
+#endif
+        near = new NeighborCommunities*[threads];
+        for (int t = 0; t < threads; ++t) near[t] = nullptr;
+    }
+    ~ThreadAccumulators() {
+        for (int t = 0; t < threads; ++t) delete near[t];
+        delete[] near;
+    }
+    ThreadAccumulators(const ThreadAccumulators&) = delete;
+    ThreadAccumulators& operator=(const ThreadAccumulators&) = delete;
+
+    // The calling thread's accumulator (each thread only touches its own slot)
+    NeighborCommunities& local() {
+        int t = 0;
+#ifdef _OPENMP
+        t = omp_get_thread_num();
+#endif
+        if (!near[t]) near[t] = new NeighborCommunities(n);
+        return *near[t];
+    }
+};
+
+// Shared-state accessors for the parallel local moving
+static inline int loadShared(const int& x) {
+    int value;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+    value = x;
+    return value;
+}
+
+static inline double loadShared(const double& x) {
+    double value;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+    value = x;
+    return value;
+}
+
+static inline void storeShared(int& x, int value) {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+    x = value;
+}
+
+static inline void addShared(double& x, double delta) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    x += delta;
+}
+
+static inline void addShared(int& x, int delta) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    x += delta;
+}
+
+// Level 0: CSR snapshot of the input graph
+static void snapshot(const Graph& g, CommunityLevel& level) {
+    CsrSnapshot arcs(g, true, false);
+    if (arcs.negative)
+        throw GraphException("Edge weights must not be negative");
+    int n = arcs.n;
+    int size = arcs.offsets[n];
+    level.n = n;
+    level.weights = new double[size > 0 ? size : 1];
+    for (int j = 0; j < size; ++j) {
+        level.weights[j] = static_cast<double>(arcs.weights[j]);
+    }
+    // The level takes over the offsets and targets of the snapshot
+    level.offsets = arcs.offsets;
+    level.targets = arcs.targets;
+    arcs.offsets = nullptr;
+    arcs.targets = nullptr;
+    level.computeDegrees();
+}
+
+// Renumber values in [0, range) densely in order of first appearance
+static int relabel(int* values, int count, int range) {
+    int* id = new int[range > 0 ? range : 1];
+    for (int c = 0; c < range; ++c) id[c] = -1;
+    int k = 0;
+    for (int i = 0; i < count; ++i) {
+        if (id[values[i]] == -1) id[values[i]] = k++;
+        values[i] = id[values[i]];
+    }
+    delete[] id;
+    return k;
+}
+
+static double levelModularity(const CommunityLevel& level, const int* community, double resolution) {
+    if (level.total <= 0.0) return 0.0;
+    int n = level.n;
+    double* tot = new double[n > 0 ? n : 1]();
+    double inside = 0.0;
+    for (int v = 0; v < n; ++v) {
+        tot[community[v]] += level.degree[v];
+        for (int j = level.offsets[v]; j < level.offsets[v + 1]; ++j) {
+            if (community[level.targets[j]] == community[v]) inside += level.weights[j];
+        }
+    }
+    double spread = 0.0;
+    for (int c = 0; c < n; ++c) {
+        double share = tot[c] / level.total;
+        spread += share * share;
+    }
+    delete[] tot;
+    return inside / level.total - resolution * spread;
+}
+
+double Community::modularity(const Graph& g, const int* community, double resolution) {
+    int n = g.getVertexCount();
+    for (int v = 0; v < n; ++v) {
+        if (community[v] < 0 || community[v] >= n)
+            throw GraphException("Community index out of bounds");
+    }
+    CommunityLevel level;
+    snapshot(g, level);
+    return levelModularity(level, community, resolution);
+}
+
+/**
+ * @brief Local moving phase of one level
+ *
+ * @details Moving an isolated v into community C changes the modularity by
+ * (w(v, C) - gamma * k(v) * tot(C) / 2m) * 2 / 2m, so every vertex compares
+ * that score for its own community (with itself taken out) against each
+ * neighboring community and moves to the best one. Threads process
+ * vertices concurrently and read the current assignment and totals
+ * without locking, as in sequential Louvain but with slightly stale
+ * values. With several threads, two singletons could swap into each
+ * other's community forever, so then only the one with the larger
+ * community number may move. Returns whether any vertex moved.
+ */
+static bool moveNodes(const CommunityLevel& level, int* comm, double* tot, int* size, double resolution,
+                      ThreadAccumulators& accumulators) {
+    int n = level.n;
+    double scale = resolution / level.total;
+    bool movedAny = false;
+    for (int pass = 0; pass < MAX_PASSES; ++pass) {
+        int moved = 0;
+        double gain = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : moved, gain)
+#endif
+        {
+            NeighborCommunities& near = accumulators.local();
+            bool concurrent = false;
+#ifdef _OPENMP
+            concurrent = omp_get_num_threads() > 1;
+#pragma omp for schedule(dynamic, 256)
+#endif
+            for (int v = 0; v < n; ++v) {
+                double k = level.degree[v];
+                if (k <= 0.0) continue;
+                int own = loadShared(comm[v]);
+                for (int j = level.offsets[v]; j < level.offsets[v + 1]; ++j) {
+                    int w = level.targets[j];
+                    if (w != v) near.add(loadShared(comm[w]), level.weights[j]);
+                }
+                double stay = near.weightOf(own) - scale * k * (loadShared(tot[own]) - k);
+                int best = own;
+                double bestScore = stay;
+                for (int i = 0; i < near.count; ++i) {
+                    int c = near.touched[i];
+                    if (c == own) continue;
+                    double score = near.weightTo[c] - scale * k * loadShared(tot[c]);
+                    if (score > bestScore || (score == bestScore && best != own && c < best)) {
+                        best = c;
+                        bestScore = score;
+                    }
+                }
+                near.clear();
+                if (best == own) continue;
+                if (concurrent && best > own && loadShared(size[own]) == 1 && loadShared(size[best]) == 1) continue;
+                addShared(tot[own], -k);
+                addShared(tot[best], k);
+                addShared(size[own], -1);
+                addShared(size[best], 1);
+                storeShared(comm[v], best);
+                moved++;
+                gain += bestScore - stay;
+            }
+        }
+        if (moved == 0) break;
+        movedAny = true;
+        if (2.0 * gain / level.total < MOVE_TOLERANCE) break;
+    }
+    return movedAny;
+}
+
+/**
+ * @brief Leiden refinement of the communities of one level
+ *
+ * @details Every vertex starts as its own subcommunity. Vertices that are
+ * still singletons are visited in order and join the subcommunity of a
+ * neighbor in the same community with the largest positive modularity
+ * gain, so subcommunities stay connected and inside their community. This
+ * is the greedy (deterministic) variant of the randomized Leiden merge.
+ * refined[v] receives the subcommunity of v, numbered by one of its members.
+ */
+static void refinePartition(const CommunityLevel& level, const int* comm, int* refined, double resolution,
+                            ThreadAccumulators& accumulators) {
+    int n = level.n;
+    double scale = resolution / level.total;
+    double* tot = new double[n > 0 ? n : 1];
+    int* size = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) {
+        refined[v] = v;
+        tot[v] = level.degree[v];
+        size[v] = 1;
+    }
+    NeighborCommunities& near = accumulators.local();
+    for (int v = 0; v < n; ++v) {
+        double k = level.degree[v];
+        if (refined[v] != v || size[v] != 1 || k <= 0.0) continue;
+        for (int j = level.offsets[v]; j < level.offsets[v + 1]; ++j) {
+            int w = level.targets[j];
+            if (w != v && comm[w] == comm[v]) near.add(refined[w], level.weights[j]);
+        }
+        int best = -1;
+        double bestScore = 0.0;
+        for (int i = 0; i < near.count; ++i) {
+            int r = near.touched[i];
+            double score = near.weightTo[r] - scale * k * tot[r];
+            if (score > bestScore) {
+                best = r;
+                bestScore = score;
+            }
+        }
+        near.clear();
+        if (best == -1) continue;
+        tot[v] = 0.0;
+        size[v] = 0;
+        tot[best] += k;
+        size[best]++;
+        refined[v] = best;
+    }
+    delete[] tot;
+    delete[] size;
+}
+
+/**
+ * @brief Aggregate the vertices of a level by part[v] in [0, k)
+ *
+ * @details Members of every part are grouped by a counting sort, then each
+ * part sums the weights of its members' arcs per target part, once to size
+ * its row and once to fill it. Both passes run in parallel over parts.
+ */
+static void aggregate(const CommunityLevel& level, const int* part, int k, CommunityLevel& next,
+                      ThreadAccumulators& accumulators) {
+    int n = level.n;
+    int* start = new int[k + 1]();
+    int* members = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) start[part[v] + 1]++;
+    for (int c = 0; c < k; ++c) start[c + 1] += start[c];
+    int* fill = new int[k > 0 ? k : 1];
+    for (int c = 0; c < k; ++c) fill[c] = start[c];
+    for (int v = 0; v < n; ++v) members[fill[part[v]]++] = v;
+    delete[] fill;
+
+    next.n = k;
+    next.offsets = new int[k + 1];
+    next.offsets[0] = 0;
+    for (int round = 0; round < 2; ++round) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            NeighborCommunities& near = accumulators.local();
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for (int c = 0; c < k; ++c) {
+                for (int i = start[c]; i < start[c + 1]; ++i) {
+                    int v = members[i];
+                    for (int j = level.offsets[v]; j < level.offsets[v + 1]; ++j) {
+                        near.add(part[level.targets[j]], level.weights[j]);
+                    }
+                }
+                if (round == 0) {
+                    next.offsets[c + 1] = near.count;
+                } else {
+                    int at = next.offsets[c];
+                    for (int i = 0; i < near.count; ++i) {
+                        next.targets[at + i] = near.touched[i];
+                        next.weights[at + i] = near.weightTo[near.touched[i]];
+                    }
+                }
+                near.clear();
+            }
+        }
+        if (round == 0) {
+            for (int c = 0; c < k; ++c) next.offsets[c + 1] += next.offsets[c];
+            next.targets = new int[next.offsets[k] > 0 ? next.offsets[k] : 1];
+            next.weights = new double[next.offsets[k] > 0 ? next.offsets[k] : 1];
+        }
+    }
+    delete[] start;
+    delete[] members;
+    next.computeDegrees();
+}
+
+/**
+ * @brief Multi-level Louvain / Leiden driver
+ *
+ * @details The snapshot of the input is kept as level 0 for the final
+ * modularity. assignment[v] is the vertex of the current level that contains
+ * input vertex v. A level starts from 'initial' (singletons, or with
+ * refinement the communities the refined sets came from), runs local
+ * moving, and is aggregated by its communities or refined subcommunities.
+ * When refinement cannot merge anything, the communities are aggregated
+ * instead. The loop ends once aggregation would not shrink the level.
+ */
+int* Community::louvain(const Graph& g, int& communities, double& modularity,
+                        bool refine, double resolution) {
+    if (!(resolution > 0.0))
+        throw GraphException("Resolution must be positive");
+    CommunityLevel input;
+    snapshot(g, input);
+    CommunityLevel current;
+    const CommunityLevel* level = &input;
+    int n = input.n;
+    int* assignment = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) assignment[v] = v;
+    int* initial = nullptr;
+    ThreadAccumulators accumulators(n);
+
+    while (level->total > 0.0) {
+        int m = level->n;
+        int* comm = new int[m > 0 ? m : 1];
+        double* tot = new double[m > 0 ? m : 1]();
+        int* size = new int[m > 0 ? m : 1]();
+        for (int v = 0; v < m; ++v) {
+            comm[v] = initial ? initial[v] : v;
+            tot[comm[v]] += level->degree[v];
+            size[comm[v]]++;
+        }
+        delete[] initial;
+        initial = nullptr;
+        moveNodes(*level, comm, tot, size, resolution, accumulators);
+        delete[] tot;
+        delete[] size;
+
+        int* part = new int[m > 0 ? m : 1];
+        int k = m;
+        bool refined = false;
+        if (refine) {
+            refinePartition(*level, comm, part, resolution, accumulators);
+            k = relabel(part, m, m);
+            refined = k < m;
+        }
+        if (!refined) {
+            for (int v = 0; v < m; ++v) part[v] = comm[v];
+            k = relabel(part, m, m);
+        }
+        if (k == m) {
+            for (int v = 0; v < n; ++v) assignment[v] = comm[assignment[v]];
+            delete[] comm;
+            delete[] part;
+            break;
+        }
+
+        if (refined) {
+            initial = new int[k];
+            for (int v = 0; v < m; ++v) initial[part[v]] = comm[v];
+            relabel(initial, k, m);
+        }
+        for (int v = 0; v < n; ++v) assignment[v] = part[assignment[v]];
+        CommunityLevel next;
+        aggregate(*level, part, k, next, accumulators);
+        current.exchange(next);
+        level = &current;
+        delete[] comm;
+        delete[] part;
+    }
+    delete[] initial;
+
+    communities = relabel(assignment, n, n);
+    modularity = levelModularity(input, assignment, resolution);
+    return assignment;
+}
+
+// Pseudo-random but reproducible order of the labels tied at vertex v
+static inline unsigned tieRank(int v, int label) {
+    unsigned h = static_cast<unsigned>(v) * 0x9E3779B1u ^ static_cast<unsigned>(label) * 0x85EBCA77u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    return h ^ (h >> 12);
+}
+
+// Mark v for the next iteration unless already marked; returns whether it was newly marked
+static inline bool markActive(char* queued, int v) {
+    char before;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+    { before = queued[v]; queued[v] = 1; }
+    return before == 0;
+}
+
+/**
+ * @brief Asynchronous label propagation over an active frontier
+ *
+ * @details queued[v] is set while v waits in the current or the next
+ * frontier, and cleared when v is processed, so a vertex is listed at most
+ * once per frontier and can be queued again by a later change. A vertex
+ * whose label changes queues its neighbors with a different label, the
+ * only ones whose choice can change because of it.
+ */
+int* Community::labelPropagation(const Graph& g, int& communities, int maxIterations) {
+    if (maxIterations < 0)
+        throw GraphException("Iteration count must not be negative");
+    CommunityLevel level;
+    snapshot(g, level);
+    int n = level.n;
+    int* labels = new int[n > 0 ? n : 1];
+    int* frontier = new int[n > 0 ? n : 1];
+    int* next = new int[n > 0 ? n : 1];
+    char* queued = new char[n > 0 ? n : 1];
+    int frontierSize = 0;
+    for (int v = 0; v < n; ++v) {
+        labels[v] = v;
+        queued[v] = level.offsets[v + 1] > level.offsets[v];
+        if (queued[v]) frontier[frontierSize++] = v;
+    }
+
+    ThreadAccumulators accumulators(n);
+    for (int iteration = 0; iteration < maxIterations && frontierSize > 0; ++iteration) {
+        int nextSize = 0;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            NeighborCommunities& near = accumulators.local();
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+            for (int i = 0; i < frontierSize; ++i) {
+                int v = frontier[i];
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+                queued[v] = 0;
+                for (int j = level.offsets[v]; j < level.offsets[v + 1]; ++j) {
+                    int w = level.targets[j];
+                    if (w != v) near.add(loadShared(labels[w]), level.weights[j]);
+                }
+                int own = labels[v];
+                int best = own;
+                double bestWeight = near.weightOf(own);
+                unsigned bestRank = 0;
+                for (int t = 0; t < near.count; ++t) {
+                    int c = near.touched[t];
+                    double weight = near.weightTo[c];
+                    if (weight < bestWeight || c == own || (weight == bestWeight && best == own)) continue;
+                    unsigned rank = tieRank(v, c);
+                    if (weight > bestWeight || rank < bestRank) {
+                        best = c;
+                        bestWeight = weight;
+                        bestRank = rank;
+                    }
+                }
+                near.clear();
+                if (best == own) continue;
+                storeShared(labels[v], best);
+                for (int j = level.offsets[v]; j < level.offsets[v + 1]; ++j) {
+                    int w = level.targets[j];
+                    if (w == v || loadShared(labels[w]) == best || !markActive(queued, w)) continue;
+                    int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                    slot = nextSize++;
+                    next[slot] = w;
+                }
+            }
+        }
+        swap(frontier, next);
+        frontierSize = nextSize;
+    }
+
+    delete[] frontier;
+    delete[] next;
+    delete[] queued;
+    communities = relabel(labels, n, n);
+    return labels;
+}
+
+} // namespace graph
@@ -0,0 +1,363 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "CompressedGraph.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+#include <climits>
+#include <cstring>
+
+namespace graph {
+
+// Variable-length integer coding: 7 payload bits per byte, high bit set on
+// every byte except the last one.
+static int varintSize(unsigned long long value) {
+    int size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+static void writeVarint(unsigned char*& out, unsigned long long value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<unsigned char>(value);
+}
+
+static inline unsigned long long readVarint(const unsigned char*& in) {
+    unsigned long long value = *in++;
+    if (value < 0x80) return value;
+    value &= 0x7F;
+    int shift = 7;
+    while (true) {
+        unsigned long long byte = *in++;
+        value |= (byte & 0x7F) << shift;
+        if (byte < 0x80) return value;
+        shift += 7;
+    }
+}
+
+// Zigzag mapping of signed to unsigned values so small magnitudes stay small
+static unsigned long long zigzag(long long value) {
+    return (static_cast<unsigned long long>(value) << 1) ^ static_cast<unsigned long long>(value >> 63);
+}
+
+static inline long long unzigzag(unsigned long long value) {
+    return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+}
+
+// Integral weights are stored as zigzag varints; floating-point weights
+// (GRAPH_WEIGHT_TYPE float/double) are stored as their raw bytes.
+static const bool FLOATING_WEIGHTS = static_cast<Weight>(0.5) != static_cast<Weight>(0);
+
+static int weightSize(Weight weight) {
+    if (FLOATING_WEIGHTS) return static_cast<int>(sizeof(Weight));
+    return varintSize(zigzag(static_cast<long long>(weight)));
+}
+
+static void writeWeight(unsigned char*& out, Weight weight) {
+    if (FLOATING_WEIGHTS) {
+        memcpy(out, &weight, sizeof(Weight));
+        out += sizeof(Weight);
+    } else {
+        writeVarint(out, zigzag(static_cast<long long>(weight)));
+    }
+}
+
+static inline Weight readWeight(const unsigned char*& in) {
+    if (FLOATING_WEIGHTS) {
+        Weight weight;
+        memcpy(&weight, in, sizeof(Weight));
+        in += sizeof(Weight);
+        return weight;
+    }
+    return static_cast<Weight>(unzigzag(readVarint(in)));
+}
+
+// Orders neighbors by (vertex, weight)
+struct NeighborLess {
+    bool operator()(const Neighbor& a, const Neighbor& b) const {
+        return a.vertex < b.vertex || (a.vertex == b.vertex && a.weight < b.weight);
+    }
+};
+
+static void sortNeighbors(Neighbor* items, int count) {
+    heapSort(items, count, NeighborLess());
+}
+
+// Size in bytes of one encoded vertex record (neighbors already sorted)
+static long long recordSize(int vertex, const Neighbor* neighbors, int count, bool unitWeights) {
+    long long size = varintSize(static_cast<unsigned long long>(count));
+    for (int i = 0; i < count; ++i) {
+        unsigned long long id = i == 0 ? zigzag(neighbors[0].vertex - vertex)
+                                       : static_cast<unsigned long long>(neighbors[i].vertex - neighbors[i - 1].vertex);
+        size += varintSize(id);
+        if (!unitWeights) size += weightSize(neighbors[i].weight);
+    }
+    return size;
+}
+
+// Encode one vertex record (neighbors already sorted) and advance out past it
+static void encodeRecord(unsigned char*& out, int vertex, const Neighbor* neighbors, int count,
+                         bool unitWeights) {
+    writeVarint(out, static_cast<unsigned long long>(count));
+    for (int i = 0; i < count; ++i) {
+        unsigned long long id = i == 0 ? zigzag(neighbors[0].vertex - vertex)
+                                       : static_cast<unsigned long long>(neighbors[i].vertex - neighbors[i - 1].vertex);
+        writeVarint(out, id);
+        if (!unitWeights) writeWeight(out, neighbors[i].weight);
+    }
+}
+
+/**
+ * @brief Constructor - Compress a graph
+ *
+ * @details Two passes over the adjacency lists: the first sorts each list and
+ * measures its encoded size to build the offset table, the second encodes the
+ * records into a byte array of exactly the total size. Only one neighbor
+ * buffer of the maximum degree is needed during construction.
+ */
+CompressedGraph::CompressedGraph(const Graph& g)
+    : numVertices(g.getVertexCount()), maxDegree(g.getMaxDegree()), unitWeights(true),
+      offsets(nullptr), data(nullptr) {
+    Neighbor* buffer = new Neighbor[maxDegree + 1];
+
+    for (int v = 0; v < numVertices && unitWeights; ++v) {
+        int count = g.copyNeighbors(v, buffer);
+        for (int i = 0; i < count; ++i) {
+            if (buffer[i].weight != 1) {
+                unitWeights = false;
+                break;
+            }
+        }
+    }
+
+    offsets = new long long[numVertices + 1];
+    offsets[0] = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        int count = g.copyNeighbors(v, buffer);
+        sortNeighbors(buffer, count);
+        offsets[v + 1] = offsets[v] + recordSize(v, buffer, count, unitWeights);
+    }
+
+    data = new unsigned char[offsets[numVertices] > 0 ? offsets[numVertices] : 1];
+    for (int v = 0; v < numVertices; ++v) {
+        int count = g.copyNeighbors(v, buffer);
+        sortNeighbors(buffer, count);
+        unsigned char* out = data + offsets[v];
+        encodeRecord(out, v, buffer, count, unitWeights);
+    }
+
+    delete[] buffer;
+}
+
+/**
+ * @brief Constructor - Compress an edge array without building a Graph
+ *
+ * @details Degrees are counted first, then every half-edge is bucketed once
+ * into its vertex's run of one array (a counting sort by endpoint, each
+ * run filled from its end so the counters end up at the run starts). Each
+ * run is sorted and measured to build the offset table, and the sorted
+ * runs are then encoded into a byte array of exactly the total size. Both
+ * per-vertex loops run in parallel under OpenMP.
+ */
+CompressedGraph::CompressedGraph(int vertices, const Edge* edges, long long count)
+    : numVertices(0), maxDegree(0), unitWeights(true), offsets(nullptr), data(nullptr) {
+    if (vertices < 0)
+        throw GraphException("Vertex count must not be negative");
+    if (count < 0 || (count > 0 && edges == nullptr))
+        throw GraphException("Invalid edge count");
+    long long* start = new long long[vertices + 1]();
+    for (long long i = 0; i < count; ++i) {
+        if (edges[i].src < 0 || edges[i].src >= vertices ||
+            edges[i].dest < 0 || edges[i].dest >= vertices) {
+            delete[] start;
+            throw GraphException("Vertex index out of bounds");
+        }
+#ifndef GRAPH_UNWEIGHTED
+        if (edges[i].weight != 1) unitWeights = false;
+#endif
+        start[edges[i].src]++;
+        start[edges[i].dest]++;
+    }
+    for (int v = 0; v < vertices; ++v) {
+        if (start[v] > INT_MAX) {
+            delete[] start;
+            throw GraphException("Too many edges at one vertex");
+        }
+        if (start[v] > maxDegree) maxDegree = static_cast<int>(start[v]);
+    }
+    numVertices = vertices;
+
+    // start[v] becomes the end of v's run, then counts down to its beginning
+    long long end = 0;
+    for (int v = 0; v < vertices; ++v) {
+        end += start[v];
+        start[v] = end;
+    }
+    start[vertices] = end;
+    Neighbor* halves = new Neighbor[end > 0 ? end : 1];
+    for (long long i = 0; i < count; ++i) {
+        int src = edges[i].src;
+        int dest = edges[i].dest;
+#ifdef GRAPH_UNWEIGHTED
+        Weight weight = 1;
+#else
+        Weight weight = edges[i].weight;
+#endif
+        Neighbor* half = &halves[--start[src]];
+        half->vertex = dest;
+        half->weight = weight;
+        half = &halves[--start[dest]];
+        half->vertex = src;
+        half->weight = weight;
+    }
+
+    offsets = new long long[vertices + 1];
+    offsets[0] = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < vertices; ++v) {
+        int degree = static_cast<int>(start[v + 1] - start[v]);
+        sortNeighbors(halves + start[v], degree);
+        offsets[v + 1] = recordSize(v, halves + start[v], degree, unitWeights);
+    }
+    for (int v = 0; v < vertices; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    data = new unsigned char[offsets[vertices] > 0 ? offsets[vertices] : 1];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < vertices; ++v) {
+        unsigned char* out = data + offsets[v];
+        encodeRecord(out, v, halves + start[v], static_cast<int>(start[v + 1] - start[v]), unitWeights);
+    }
+
+    delete[] halves;
+    delete[] start;
+}
+
+/**
+ * @brief Destructor - Free the encoded data and offset table
+ */
+CompressedGraph::~CompressedGraph() {
+    delete[] offsets;
+    delete[] data;
+}
+
+/**
+ * @brief Move constructor - take over another compressed graph's storage
+ *
+ * @param other The graph to move from (left as an empty graph)
+ */
+CompressedGraph::CompressedGraph(CompressedGraph&& other)
+    : numVertices(0), maxDegree(0), unitWeights(true), offsets(nullptr), data(nullptr) {
+    takeFrom(other);
+}
+
+/**
+ * @brief Move assignment - release own storage and take over another's
+ *
+ * @param other The graph to move from (left as an empty graph)
+ * @return Reference to this graph
+ */
+CompressedGraph& CompressedGraph::operator=(CompressedGraph&& other) {
+    if (this != &other) {
+        delete[] offsets;
+        delete[] data;
+        takeFrom(other);
+    }
+    return *this;
+}
+
+void CompressedGraph::takeFrom(CompressedGraph& other) {
+    numVertices = other.numVertices;
+    maxDegree = other.maxDegree;
+    unitWeights = other.unitWeights;
+    offsets = other.offsets;
+    data = other.data;
+    other.numVertices = 0;
+    other.maxDegree = 0;
+    other.unitWeights = true;
+    other.offsets = nullptr;
+    other.data = nullptr;
+}
+
+void CompressedGraph::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices)
+        throw GraphException("Vertex index out of bounds");
+}
+
+int CompressedGraph::getVertexCount() const {
+    return numVertices;
+}
+
+int CompressedGraph::getDegree(int vertex) const {
+    checkVertex(vertex);
+    const unsigned char* in = data + offsets[vertex];
+    return static_cast<int>(readVarint(in));
+}
+
+int CompressedGraph::getMaxDegree() const {
+    return maxDegree;
+}
+
+Neighbor* CompressedGraph::getNeighbors(int vertex, int& count) const {
+    count = getDegree(vertex);
+    Neighbor* neighbors = new Neighbor[count];
+    copyNeighbors(vertex, neighbors);
+    return neighbors;
+}
+
+/**
+ * @brief Decode the neighbors of a vertex into a caller-provided buffer
+ *
+ * @details Reads the degree, then reconstructs each neighbor ID by adding the
+ * decoded gap to the previous ID. The branch on unitWeights is hoisted out of
+ * the loop so the unweighted case is a tight varint-and-add loop.
+ */
+int CompressedGraph::copyNeighbors(int vertex, Neighbor* out) const {
+    checkVertex(vertex);
+    const unsigned char* in = data + offsets[vertex];
+    int count = static_cast<int>(readVarint(in));
+    if (count == 0) return 0;
+
+    int current = vertex + static_cast<int>(unzigzag(readVarint(in)));
+    if (unitWeights) {
+        out[0].vertex = current;
+        out[0].weight = 1;
+        for (int i = 1; i < count; ++i) {
+            current += static_cast<int>(readVarint(in));
+            out[i].vertex = current;
+            out[i].weight = 1;
+        }
+    } else {
+        out[0].vertex = current;
+        out[0].weight = readWeight(in);
+        for (int i = 1; i < count; ++i) {
+            current += static_cast<int>(readVarint(in));
+            out[i].vertex = current;
+            out[i].weight = readWeight(in);
+        }
+    }
+    return count;
+}
+
+bool CompressedGraph::hasUnitWeights() const {
+    return unitWeights;
+}
+
+long long CompressedGraph::getByteSize() const {
+    if (!offsets) return 0;
+    return offsets[numVertices] + static_cast<long long>(numVertices + 1) * sizeof(long long);
+}
+
+} // namespace graph
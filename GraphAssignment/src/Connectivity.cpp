@@ -0,0 +1,553 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Connectivity.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+
+namespace graph {
+
+static Edge makeEdge(int u, int v, Weight w) {
+    Edge e;
+    e.src = u < v ? u : v;
+    e.dest = u < v ? v : u;
+    e.weight = w;
+    return e;
+}
+
+// Edge stack entries keep their orientation (tree edges parent to child, back
+// edges descendant to ancestor) so a parallel copy is told apart from the tree edge
+static void pushEdge(Edge* stack, int& top, int u, int v, Weight w) {
+    stack[top].src = u;
+    stack[top].dest = v;
+    stack[top].weight = w;
+    top++;
+}
+
+/**
+ * @brief Hopcroft-Tarjan low-link DFS with an explicit stack
+ *
+ * @details next[v] is the position of the next neighbor of v to scan, so a
+ * vertex on top of the stack resumes where it stopped, exactly like the
+ * return from a recursive call. The first copy of the parent edge in a
+ * vertex's list is the tree edge and is skipped; further copies are back
+ * edges, which keeps parallel edges from being reported as bridges.
+ *
+ * When a child v finishes with low[v] >= disc[p], p separates v's subtree:
+ * the edges pushed since the tree edge (p, v) form one biconnected component.
+ * Each output is only produced if its pointer is not null; the edge stack is
+ * only kept when components are requested.
+ */
+static void lowLink(const CsrSnapshot& a, Edge* bridgeList, int* bridgeCount,
+                    bool* articulation, Edge* bccEdges, int* bccLabel, int* bccCount) {
+    int n = a.n;
+    int* disc = new int[n > 0 ? n : 1];
+    int* low = new int[n > 0 ? n : 1];
+    int* parent = new int[n > 0 ? n : 1];
+    int* next = new int[n > 0 ? n : 1];
+    Weight* treeWeight = new Weight[n > 0 ? n : 1];
+    bool* skippedParent = new bool[n > 0 ? n : 1]();
+    int* stack = new int[n > 0 ? n : 1];
+    int edgeSlots = bccEdges ? a.offsets[n] / 2 + 1 : 1;
+    Edge* edgeStack = new Edge[edgeSlots];
+    int edgeTop = 0, emitted = 0, components = 0, bridges = 0;
+
+    for (int v = 0; v < n; ++v) {
+        disc[v] = -1;
+        parent[v] = -1;
+        next[v] = a.offsets[v];
+        if (articulation) articulation[v] = false;
+    }
+
+    int time = 0;
+    for (int root = 0; root < n; ++root) {
+        if (disc[root] != -1) continue;
+        int rootChildren = 0;
+        int top = 0;
+        disc[root] = low[root] = time++;
+        stack[top++] = root;
+
+        while (top > 0) {
+            int v = stack[top - 1];
+            if (next[v] < a.offsets[v + 1]) {
+                int slot = next[v]++;
+                int w = a.targets[slot];
+                if (w == v) continue;
+                if (w == parent[v] && !skippedParent[v]) {
+                    skippedParent[v] = true;
+                    continue;
+                }
+                if (disc[w] == -1) {
+                    parent[w] = v;
+                    treeWeight[w] = a.weights[slot];
+                    disc[w] = low[w] = time++;
+                    if (bccEdges) pushEdge(edgeStack, edgeTop, v, w, a.weights[slot]);
+                    stack[top++] = w;
+                } else if (disc[w] < disc[v]) {
+                    if (disc[w] < low[v]) low[v] = disc[w];
+                    if (bccEdges) pushEdge(edgeStack, edgeTop, v, w, a.weights[slot]);
+                }
+                continue;
+            }
+
+            top--;
+            int p = parent[v];
+            if (p == -1) continue;
+            if (low[v] < low[p]) low[p] = low[v];
+            if (low[v] > disc[p] && bridgeList) {
+                bridgeList[bridges++] = makeEdge(p, v, treeWeight[v]);
+            }
+            if (low[v] >= disc[p]) {
+                if (p == root) {
+                    rootChildren++;
+                } else if (articulation) {
+                    articulation[p] = true;
+                }
+                if (bccEdges) {
+                    while (edgeTop > 0) {
+                        Edge e = edgeStack[--edgeTop];
+                        bccEdges[emitted] = makeEdge(e.src, e.dest, e.weight);
+                        bccLabel[emitted++] = components;
+                        // The tree edge (p, v) was pushed before every edge of
+                        // v's subtree, so reaching it closes the component
+                        if (e.src == p && e.dest == v) break;
+                    }
+                    components++;
+                }
+            }
+        }
+        if (articulation && rootChildren >= 2) articulation[root] = true;
+    }
+
+    if (bridgeCount) *bridgeCount = bridges;
+    if (bccCount) *bccCount = components;
+    delete[] disc;
+    delete[] low;
+    delete[] parent;
+    delete[] next;
+    delete[] treeWeight;
+    delete[] skippedParent;
+    delete[] stack;
+    delete[] edgeStack;
+}
+
+Edge* Connectivity::bridges(const Graph& g, int& count) {
+    CsrSnapshot a(g, true, false);
+    Edge* result = new Edge[a.n > 0 ? a.n : 1];
+    lowLink(a, result, &count, nullptr, nullptr, nullptr, nullptr);
+    return result;
+}
+
+bool* Connectivity::articulationPoints(const Graph& g) {
+    CsrSnapshot a(g, true, false);
+    bool* result = new bool[a.n > 0 ? a.n : 1];
+    lowLink(a, nullptr, nullptr, result, nullptr, nullptr, nullptr);
+    return result;
+}
+
+int Connectivity::biconnectedComponents(const Graph& g, Edge*& edges, int*& component, int& edgeCount) {
+    CsrSnapshot a(g, true, false);
+    int loopSlots = 0;
+    for (int v = 0; v < a.n; ++v) {
+        for (int i = a.offsets[v]; i < a.offsets[v + 1]; ++i) {
+            if (a.targets[i] == v) loopSlots++;
+        }
+    }
+    edgeCount = (a.offsets[a.n] - loopSlots) / 2;
+    edges = new Edge[edgeCount > 0 ? edgeCount : 1];
+    component = new int[edgeCount > 0 ? edgeCount : 1];
+    int components = 0;
+    lowLink(a, nullptr, nullptr, nullptr, edges, component, &components);
+    return components;
+}
+
+// Atomic helpers for the parallel phases; plain operations without OpenMP
+static int loadInt(const int* p) {
+#ifdef _OPENMP
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+#else
+    return *p;
+#endif
+}
+
+static bool casInt(int* p, int expected, int desired) {
+#ifdef _OPENMP
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+#else
+    if (*p != expected) return false;
+    *p = desired;
+    return true;
+#endif
+}
+
+// Lock-free union-find: roots only ever link to a smaller root, so no cycle
+// can form, and path halving shortens paths with a compare-and-swap
+static int concurrentFind(int* parent, int x) {
+    while (true) {
+        int p = loadInt(&parent[x]);
+        if (p == x) return x;
+        int gp = loadInt(&parent[p]);
+        if (gp != p) casInt(&parent[x], p, gp);
+        x = p;
+    }
+}
+
+static void concurrentUnite(int* parent, int a, int b) {
+    while (true) {
+        a = concurrentFind(parent, a);
+        b = concurrentFind(parent, b);
+        if (a == b) return;
+        if (a < b) swap(a, b);
+        if (casInt(&parent[a], a, b)) return;
+    }
+}
+
+/**
+ * @brief Tarjan-Vishkin state over a BFS spanning forest
+ *
+ * @details The forest is built one BFS level at a time; order lists the
+ * vertices level by level and levelStart the level boundaries, which lets
+ * the later phases sweep the forest bottom-up or top-down with one parallel
+ * loop per level. treeSlot[w] is the position of the tree edge (parent[w], w)
+ * in the parent's neighbor list, so parallel copies stay non-tree edges.
+ *
+ * Tree edges are identified by their child vertex. After the preorder
+ * numbering, the subtree of v is the interval [pre[v], pre[v] + size[v]) and
+ * low/high are the extreme preorder numbers reachable from the subtree by
+ * one non-tree edge. A tree edge (v, w) is a bridge when w's subtree reaches
+ * nothing outside its interval. Biconnected components are the connected
+ * components of an auxiliary graph over the tree edges, built in
+ * labelComponents().
+ */
+struct SpanningForest {
+    const CsrSnapshot& a;
+    int* parent;
+    int* treeSlot;
+    int* order;
+    int* levelStart;
+    int levels;
+    int* size;
+    int* pre;
+    int* low;
+    int* high;
+
+    explicit SpanningForest(const CsrSnapshot& adjacency);
+    ~SpanningForest() {
+        delete[] parent;
+        delete[] treeSlot;
+        delete[] order;
+        delete[] levelStart;
+        delete[] size;
+        delete[] pre;
+        delete[] low;
+        delete[] high;
+    }
+    SpanningForest(const SpanningForest&) = delete;
+    SpanningForest& operator=(const SpanningForest&) = delete;
+
+    bool isTreeSlot(int v, int slot) const { return treeSlot[a.targets[slot]] == slot && parent[a.targets[slot]] == v; }
+    bool isAncestor(int u, int v) const { return pre[u] <= pre[v] && pre[v] < pre[u] + size[u]; }
+    bool isBridge(int w) const { return parent[w] != -1 && low[w] >= pre[w] && high[w] < pre[w] + size[w]; }
+    int* labelComponents() const;
+
+private:
+    void buildForest();
+    void numberPreorder();
+    void computeLowHigh();
+};
+
+SpanningForest::SpanningForest(const CsrSnapshot& adjacency)
+    : a(adjacency), parent(nullptr), treeSlot(nullptr), order(nullptr), levelStart(nullptr),
+      levels(0), size(nullptr), pre(nullptr), low(nullptr), high(nullptr) {
+    int slots = a.n > 0 ? a.n : 1;
+    parent = new int[slots];
+    treeSlot = new int[slots];
+    order = new int[slots];
+    levelStart = new int[slots + 1];
+    size = new int[slots];
+    pre = new int[slots];
+    low = new int[slots];
+    high = new int[slots];
+    buildForest();
+    numberPreorder();
+    computeLowHigh();
+}
+
+// Level-synchronous BFS from every unvisited vertex; order doubles as the queue
+void SpanningForest::buildForest() {
+    int n = a.n;
+    int* visited = new int[n > 0 ? n : 1];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < n; ++v) {
+        visited[v] = 0;
+        parent[v] = -1;
+        treeSlot[v] = -1;
+        size[v] = 1;
+    }
+
+    int tail = 0;
+    for (int root = 0; root < n; ++root) {
+        if (visited[root]) continue;
+        visited[root] = 1;
+        int head = tail;
+        order[tail++] = root;
+        while (head < tail) {
+            levelStart[levels++] = head;
+            int end = tail;
+            int nextTail = tail;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+            for (int i = head; i < end; ++i) {
+                int u = order[i];
+                for (int slot = a.offsets[u]; slot < a.offsets[u + 1]; ++slot) {
+                    int w = a.targets[slot];
+                    if (loadInt(&visited[w]) || !casInt(&visited[w], 0, 1)) continue;
+                    parent[w] = u;
+                    treeSlot[w] = slot;
+                    int at;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                    at = nextTail++;
+                    order[at] = w;
+                }
+            }
+            head = end;
+            tail = nextTail;
+        }
+    }
+    levelStart[levels] = tail;
+    delete[] visited;
+}
+
+// Subtree sizes bottom-up, then preorder numbers top-down: a parent hands
+// consecutive intervals of its own interval to its children
+void SpanningForest::numberPreorder() {
+    for (int level = levels - 1; level >= 0; --level) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int i = levelStart[level]; i < levelStart[level + 1]; ++i) {
+            int w = order[i];
+            if (parent[w] == -1) continue;  // First level of another tree
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            size[parent[w]] += size[w];
+        }
+    }
+
+    int next = 0;
+    for (int level = 0; level < levels; ++level) {
+        for (int i = levelStart[level]; i < levelStart[level + 1]; ++i) {
+            int v = order[i];
+            if (parent[v] == -1) {
+                pre[v] = next;
+                next += size[v];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+        for (int i = levelStart[level]; i < levelStart[level + 1]; ++i) {
+            int v = order[i];
+            int cursor = pre[v] + 1;
+            for (int slot = a.offsets[v]; slot < a.offsets[v + 1]; ++slot) {
+                if (isTreeSlot(v, slot)) {
+                    int w = a.targets[slot];
+                    pre[w] = cursor;
+                    cursor += size[w];
+                }
+            }
+        }
+    }
+}
+
+// low/high over the non-tree edges at each vertex, then folded into parents
+// bottom-up. The first copy of the parent in a vertex's list is its tree edge.
+void SpanningForest::computeLowHigh() {
+    int n = a.n;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < n; ++v) {
+        int lo = pre[v], hi = pre[v];
+        bool skippedParent = false;
+        for (int slot = a.offsets[v]; slot < a.offsets[v + 1]; ++slot) {
+            int w = a.targets[slot];
+            if (w == v || isTreeSlot(v, slot)) continue;
+            if (w == parent[v] && !skippedParent) {
+                skippedParent = true;
+                continue;
+            }
+            if (pre[w] < lo) lo = pre[w];
+            if (pre[w] > hi) hi = pre[w];
+        }
+        low[v] = lo;
+        high[v] = hi;
+    }
+
+    for (int level = levels - 2; level >= 0; --level) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+        for (int i = levelStart[level]; i < levelStart[level + 1]; ++i) {
+            int v = order[i];
+            for (int slot = a.offsets[v]; slot < a.offsets[v + 1]; ++slot) {
+                if (!isTreeSlot(v, slot)) continue;
+                int w = a.targets[slot];
+                if (low[w] < low[v]) low[v] = low[w];
+                if (high[w] > high[v]) high[v] = high[w];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Union-find labels of the tree edges (by child vertex)
+ *
+ * @details Two tree edges share a biconnected component when
+ *  (a) a non-tree edge joins their child vertices and neither is an
+ *      ancestor of the other, or
+ *  (b) they are consecutive edges (v, w) and (parent[v], v) and w's subtree
+ *      reaches outside v's subtree by a non-tree edge.
+ * Every edge, tree or not, then belongs to the component of the tree edge
+ * above its endpoint with the larger preorder number. Returns the
+ * union-find array; find() on it gives the label of a tree edge.
+ */
+int* SpanningForest::labelComponents() const {
+    int n = a.n;
+    int* components = new int[n > 0 ? n : 1];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < n; ++v) {
+        components[v] = v;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < n; ++v) {
+        int p = parent[v];
+        if (p != -1 && parent[p] != -1 && (low[v] < pre[p] || high[v] >= pre[p] + size[p])) {
+            concurrentUnite(components, v, p);
+        }
+        bool skippedParent = false;
+        for (int slot = a.offsets[v]; slot < a.offsets[v + 1]; ++slot) {
+            int w = a.targets[slot];
+            if (w == p && !skippedParent) {
+                skippedParent = true;
+                continue;
+            }
+            if (pre[w] < pre[v] && !isAncestor(w, v)) {
+                concurrentUnite(components, v, w);
+            }
+        }
+    }
+    return components;
+}
+
+Edge* Connectivity::bridgesParallel(const Graph& g, int& count) {
+    CsrSnapshot a(g, true, false);
+    SpanningForest forest(a);
+    int n = a.n;
+    Edge* result = new Edge[n > 0 ? n : 1];
+    count = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int w = 0; w < n; ++w) {
+        if (!forest.isBridge(w)) continue;
+        int at;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        at = count++;
+        result[at] = makeEdge(forest.parent[w], w, a.weights[forest.treeSlot[w]]);
+    }
+    return result;
+}
+
+// Label of an edge: the tree edge above its endpoint with the larger preorder number
+static int edgeLabel(const SpanningForest& forest, int* components, int u, int v) {
+    return concurrentFind(components, forest.pre[u] > forest.pre[v] ? u : v);
+}
+
+bool* Connectivity::articulationPointsParallel(const Graph& g) {
+    CsrSnapshot a(g, true, false);
+    SpanningForest forest(a);
+    int* components = forest.labelComponents();
+    int n = a.n;
+    bool* result = new bool[n > 0 ? n : 1];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < n; ++v) {
+        int first = -1;
+        result[v] = false;
+        for (int slot = a.offsets[v]; slot < a.offsets[v + 1] && !result[v]; ++slot) {
+            int w = a.targets[slot];
+            if (w == v) continue;
+            int label = edgeLabel(forest, components, v, w);
+            if (first == -1) {
+                first = label;
+            } else if (label != first) {
+                result[v] = true;
+            }
+        }
+    }
+    delete[] components;
+    return result;
+}
+
+int Connectivity::biconnectedComponentsParallel(const Graph& g, Edge*& edges, int*& component, int& edgeCount) {
+    CsrSnapshot a(g, true, false);
+    SpanningForest forest(a);
+    int* components = forest.labelComponents();
+    int n = a.n;
+
+    // Dense component numbers in order of the smallest tree-edge child
+    int* number = new int[n > 0 ? n : 1];
+    int count = 0;
+    for (int v = 0; v < n; ++v) {
+        number[v] = (forest.parent[v] != -1 && concurrentFind(components, v) == v) ? count++ : -1;
+    }
+
+    // Each edge is written once, at its smaller endpoint
+    int* start = new int[n + 1];
+    start[0] = 0;
+    for (int v = 0; v < n; ++v) {
+        int m = 0;
+        for (int slot = a.offsets[v]; slot < a.offsets[v + 1]; ++slot) {
+            if (a.targets[slot] > v) m++;
+        }
+        start[v + 1] = start[v] + m;
+    }
+    edgeCount = start[n];
+    edges = new Edge[edgeCount > 0 ? edgeCount : 1];
+    component = new int[edgeCount > 0 ? edgeCount : 1];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < n; ++v) {
+        int at = start[v];
+        for (int slot = a.offsets[v]; slot < a.offsets[v + 1]; ++slot) {
+            int w = a.targets[slot];
+            if (w <= v) continue;
+            edges[at] = makeEdge(v, w, a.weights[slot]);
+            component[at++] = number[edgeLabel(forest, components, v, w)];
+        }
+    }
+
+    delete[] components;
+    delete[] number;
+    delete[] start;
+    return count;
+}
+
+} // namespace graph
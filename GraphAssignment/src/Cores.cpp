@@ -0,0 +1,240 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Cores.h"
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+// Degree without self-loops, which never disappear while peeling
+static int peelDegree(const Graph& g, int v, Neighbor* buffer) {
+    int count = g.copyNeighbors(v, buffer);
+    int d = 0;
+    for (int i = 0; i < count; ++i) {
+        if (buffer[i].vertex != v) d++;
+    }
+    return d;
+}
+
+/**
+ * @brief Batagelj-Zaversnik bucket peeling
+ *
+ * @details vert holds the vertices sorted by current degree, pos[v] is the
+ * index of v in vert and bin[d] the index of the first vertex of degree d.
+ * Processing vert in order removes vertices by non-decreasing degree; when a
+ * neighbor u of higher degree loses an edge it is swapped with the first
+ * vertex of its bucket and the bucket boundary moves up by one, which keeps
+ * vert sorted without any search.
+ */
+int* Cores::coreNumbers(const Graph& g) {
+    int n = g.getVertexCount();
+    int maxDeg = g.getMaxDegree();
+    Neighbor* neighbors = new Neighbor[maxDeg + 1];
+    int* deg = new int[n];
+    int* bin = new int[maxDeg + 1]();
+    int* pos = new int[n];
+    int* vert = new int[n];
+
+    for (int v = 0; v < n; ++v) {
+        deg[v] = peelDegree(g, v, neighbors);
+        bin[deg[v]]++;
+    }
+    int start = 0;
+    for (int d = 0; d <= maxDeg; ++d) {
+        int size = bin[d];
+        bin[d] = start;
+        start += size;
+    }
+    for (int v = 0; v < n; ++v) {
+        pos[v] = bin[deg[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = maxDeg; d > 0; --d) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+
+    for (int i = 0; i < n; ++i) {
+        int v = vert[i];
+        int count = g.copyNeighbors(v, neighbors);
+        for (int j = 0; j < count; ++j) {
+            int u = neighbors[j].vertex;
+            if (deg[u] > deg[v]) {
+                int du = deg[u];
+                int pu = pos[u];
+                int pw = bin[du];
+                int w = vert[pw];
+                if (u != w) {
+                    pos[u] = pw;
+                    vert[pu] = w;
+                    pos[w] = pu;
+                    vert[pw] = u;
+                }
+                bin[du]++;
+                deg[u]--;
+            }
+        }
+    }
+
+    delete[] neighbors;
+    delete[] bin;
+    delete[] pos;
+    delete[] vert;
+    return deg;
+}
+
+/**
+ * @brief Level-synchronous peeling
+ *
+ * @details deg[v] never drops below the current level k: a neighbor is only
+ * decremented if its degree was above k, and a decrement that raced past k
+ * is undone. The decrement that takes a degree from k + 1 to k is unique, so
+ * exactly one thread appends that vertex to the next round. Vertices peeled
+ * at lower levels keep degrees below k and are never touched again.
+ */
+int* Cores::coreNumbersParallel(const Graph& g) {
+    int n = g.getVertexCount();
+    int maxDeg = g.getMaxDegree();
+    int* deg = new int[n];
+    int* frontier = new int[n > 0 ? n : 1];
+    int* next = new int[n > 0 ? n : 1];
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        Neighbor* neighbors = new Neighbor[maxDeg + 1];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int v = 0; v < n; ++v) {
+            deg[v] = peelDegree(g, v, neighbors);
+        }
+        delete[] neighbors;
+    }
+
+    int remaining = n;
+    for (int k = 0; remaining > 0; ++k) {
+        int frontierSize = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int v = 0; v < n; ++v) {
+            if (deg[v] == k) {
+                int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                slot = frontierSize++;
+                frontier[slot] = v;
+            }
+        }
+
+        while (frontierSize > 0) {
+            int nextSize = 0;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+            {
+                Neighbor* neighbors = new Neighbor[maxDeg + 1];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+                for (int i = 0; i < frontierSize; ++i) {
+                    int v = frontier[i];
+                    int count = g.copyNeighbors(v, neighbors);
+                    for (int j = 0; j < count; ++j) {
+                        int u = neighbors[j].vertex;
+                        int du;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                        du = deg[u];
+                        if (u == v || du <= k) continue;
+                        int before;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                        before = deg[u]--;
+                        if (before == k + 1) {
+                            int slot;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                            slot = nextSize++;
+                            next[slot] = u;
+                        } else if (before <= k) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+                            deg[u]++;
+                        }
+                    }
+                }
+                delete[] neighbors;
+            }
+            remaining -= frontierSize;
+            swap(frontier, next);
+            frontierSize = nextSize;
+        }
+    }
+
+    delete[] frontier;
+    delete[] next;
+    return deg;
+}
+
+int Cores::degeneracy(const Graph& g) {
+    int n = g.getVertexCount();
+    int* core = coreNumbers(g);
+    int best = 0;
+    for (int v = 0; v < n; ++v) {
+        if (core[v] > best) best = core[v];
+    }
+    delete[] core;
+    return best;
+}
+
+// Edges with both endpoints in the k-core, bulk-inserted as in Reordering::apply
+Graph Cores::kCore(const Graph& g, int k) {
+    if (k < 0)
+        throw GraphException("Core order must not be negative");
+    int n = g.getVertexCount();
+    int* core = coreNumbers(g);
+
+    long long halfEdges = 0;
+    for (int u = 0; u < n; ++u) {
+        if (core[u] >= k) halfEdges += g.getDegree(u);
+    }
+    Edge* edges = new Edge[halfEdges / 2 + 1];
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    int m = 0;
+    for (int u = 0; u < n; ++u) {
+        if (core[u] < k) continue;
+        int count = g.copyNeighbors(u, neighbors);
+        int loops = 0;
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            // Each edge is listed at both endpoints; a self-loop twice at u
+            if (core[v] >= k && (u < v || (u == v && ++loops % 2 == 0))) {
+                edges[m].src = u;
+                edges[m].dest = v;
+                edges[m].weight = neighbors[i].weight;
+                m++;
+            }
+        }
+    }
+
+    Graph result(n);
+    result.addEdges(edges, m);
+    for (int v = 0; v < n; ++v) {
+        if (!g.hasVertex(v)) result.removeVertex(v);
+    }
+    delete[] core;
+    delete[] edges;
+    delete[] neighbors;
+    return result;
+}
+
+} // namespace graph
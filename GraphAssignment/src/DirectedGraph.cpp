@@ -0,0 +1,285 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "DirectedGraph.h"
+#include "GraphException.h"
+#include <iostream>
+
+namespace graph {
+
+/**
+ * @brief Constructor - Directed graph with no edges
+ */
+DirectedGraph::DirectedGraph(int vertices)
+    : DirectedGraph(vertices, nullptr, 0) {
+}
+
+/**
+ * @brief Constructor - Build CSR and CSC arrays from an edge list
+ *
+ * @details Three counting-sort passes, no comparison sort:
+ * 1. Scatter the edges into columns by destination (CSC, arbitrary order
+ *    within a column).
+ * 2. Walk the columns in increasing destination and scatter each edge into
+ *    the row of its source; rows are therefore sorted by destination.
+ * 3. Walk the rows in increasing source and rebuild the columns; columns are
+ *    therefore sorted by source.
+ */
+DirectedGraph::DirectedGraph(int vertices, const Edge* edges, int count)
+    : numVertices(0), numEdges(0), maxOutDegree(0), maxInDegree(0),
+      outOffsets(nullptr), outTargets(nullptr), outWeights(nullptr),
+      inOffsets(nullptr), inSources(nullptr), inWeights(nullptr) {
+    if (vertices < 0)
+        throw GraphException("Vertex count must not be negative");
+    if (count < 0 || (count > 0 && edges == nullptr))
+        throw GraphException("Invalid edge count");
+    bool unitWeights = true;
+    for (int i = 0; i < count; ++i) {
+        if (edges[i].src < 0 || edges[i].src >= vertices ||
+            edges[i].dest < 0 || edges[i].dest >= vertices)
+            throw GraphException("Vertex index out of bounds");
+#ifndef GRAPH_UNWEIGHTED
+        if (edges[i].weight != 1) unitWeights = false;
+#endif
+    }
+
+    numVertices = vertices;
+    numEdges = count;
+    outOffsets = new int[vertices + 1]();
+    inOffsets = new int[vertices + 1]();
+    outTargets = new int[count + 1];
+    inSources = new int[count + 1];
+    if (!unitWeights) {
+        outWeights = new Weight[count + 1];
+        inWeights = new Weight[count + 1];
+    }
+
+    for (int i = 0; i < count; ++i) {
+        outOffsets[edges[i].src + 1]++;
+        inOffsets[edges[i].dest + 1]++;
+    }
+    for (int v = 0; v < vertices; ++v) {
+        if (outOffsets[v + 1] > maxOutDegree) maxOutDegree = outOffsets[v + 1];
+        if (inOffsets[v + 1] > maxInDegree) maxInDegree = inOffsets[v + 1];
+        outOffsets[v + 1] += outOffsets[v];
+        inOffsets[v + 1] += inOffsets[v];
+    }
+
+    int* pos = new int[vertices + 1];
+
+    // Pass 1: edges into columns by destination
+    for (int v = 0; v < vertices; ++v) pos[v] = inOffsets[v];
+    for (int i = 0; i < count; ++i) {
+        int slot = pos[edges[i].dest]++;
+        inSources[slot] = edges[i].src;
+        if (inWeights) inWeights[slot] = edges[i].weight;
+    }
+
+    // Pass 2: columns into rows, giving rows sorted by destination
+    for (int v = 0; v < vertices; ++v) pos[v] = outOffsets[v];
+    for (int v = 0; v < vertices; ++v) {
+        for (int j = inOffsets[v]; j < inOffsets[v + 1]; ++j) {
+            int slot = pos[inSources[j]]++;
+            outTargets[slot] = v;
+            if (outWeights) outWeights[slot] = inWeights[j];
+        }
+    }
+
+    // Pass 3: rows back into columns, giving columns sorted by source
+    for (int v = 0; v < vertices; ++v) pos[v] = inOffsets[v];
+    for (int u = 0; u < vertices; ++u) {
+        for (int j = outOffsets[u]; j < outOffsets[u + 1]; ++j) {
+            int slot = pos[outTargets[j]]++;
+            inSources[slot] = u;
+            if (inWeights) inWeights[slot] = outWeights[j];
+        }
+    }
+    delete[] pos;
+}
+
+/**
+ * @brief Destructor - Free the CSR and CSC arrays
+ */
+DirectedGraph::~DirectedGraph() {
+    release();
+}
+
+DirectedGraph::DirectedGraph(DirectedGraph&& other)
+    : numVertices(0), numEdges(0), maxOutDegree(0), maxInDegree(0),
+      outOffsets(nullptr), outTargets(nullptr), outWeights(nullptr),
+      inOffsets(nullptr), inSources(nullptr), inWeights(nullptr) {
+    takeFrom(other);
+}
+
+DirectedGraph& DirectedGraph::operator=(DirectedGraph&& other) {
+    if (this != &other) {
+        release();
+        takeFrom(other);
+    }
+    return *this;
+}
+
+void DirectedGraph::release() {
+    delete[] outOffsets;
+    delete[] outTargets;
+    delete[] outWeights;
+    delete[] inOffsets;
+    delete[] inSources;
+    delete[] inWeights;
+    outOffsets = nullptr;
+    outTargets = nullptr;
+    outWeights = nullptr;
+    inOffsets = nullptr;
+    inSources = nullptr;
+    inWeights = nullptr;
+    numVertices = 0;
+    numEdges = 0;
+    maxOutDegree = 0;
+    maxInDegree = 0;
+}
+
+/**
+ * @brief Take over the arrays of another graph and reset it to empty
+ *
+ * @details Assumes this graph currently owns no arrays. The moved-from graph
+ * gets fresh zero-vertex offset tables so that it stays usable.
+ */
+void DirectedGraph::takeFrom(DirectedGraph& other) {
+    numVertices = other.numVertices;
+    numEdges = other.numEdges;
+    maxOutDegree = other.maxOutDegree;
+    maxInDegree = other.maxInDegree;
+    outOffsets = other.outOffsets;
+    outTargets = other.outTargets;
+    outWeights = other.outWeights;
+    inOffsets = other.inOffsets;
+    inSources = other.inSources;
+    inWeights = other.inWeights;
+
+    other.outOffsets = nullptr;
+    other.outTargets = nullptr;
+    other.outWeights = nullptr;
+    other.inOffsets = nullptr;
+    other.inSources = nullptr;
+    other.inWeights = nullptr;
+    other.release();
+    other.outOffsets = new int[1]();
+    other.inOffsets = new int[1]();
+}
+
+void DirectedGraph::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices)
+        throw GraphException("Vertex index out of bounds");
+}
+
+int DirectedGraph::getVertexCount() const {
+    return numVertices;
+}
+
+int DirectedGraph::getEdgeCount() const {
+    return numEdges;
+}
+
+int DirectedGraph::getDegree(int vertex) const {
+    checkVertex(vertex);
+    return outOffsets[vertex + 1] - outOffsets[vertex];
+}
+
+int DirectedGraph::getInDegree(int vertex) const {
+    checkVertex(vertex);
+    return inOffsets[vertex + 1] - inOffsets[vertex];
+}
+
+int DirectedGraph::getMaxDegree() const {
+    return maxOutDegree;
+}
+
+int DirectedGraph::getMaxInDegree() const {
+    return maxInDegree;
+}
+
+Neighbor* DirectedGraph::getNeighbors(int vertex, int& count) const {
+    count = getDegree(vertex);
+    Neighbor* neighbors = new Neighbor[count];
+    copyNeighbors(vertex, neighbors);
+    return neighbors;
+}
+
+int DirectedGraph::copyNeighbors(int vertex, Neighbor* out) const {
+    checkVertex(vertex);
+    int begin = outOffsets[vertex];
+    int count = outOffsets[vertex + 1] - begin;
+    for (int i = 0; i < count; ++i) {
+        out[i].vertex = outTargets[begin + i];
+        out[i].weight = outWeights ? outWeights[begin + i] : 1;
+    }
+    return count;
+}
+
+Neighbor* DirectedGraph::getInNeighbors(int vertex, int& count) const {
+    count = getInDegree(vertex);
+    Neighbor* neighbors = new Neighbor[count];
+    copyInNeighbors(vertex, neighbors);
+    return neighbors;
+}
+
+int DirectedGraph::copyInNeighbors(int vertex, Neighbor* out) const {
+    checkVertex(vertex);
+    int begin = inOffsets[vertex];
+    int count = inOffsets[vertex + 1] - begin;
+    for (int i = 0; i < count; ++i) {
+        out[i].vertex = inSources[begin + i];
+        out[i].weight = inWeights ? inWeights[begin + i] : 1;
+    }
+    return count;
+}
+
+bool DirectedGraph::hasEdge(int src, int dest) const {
+    checkVertex(src);
+    checkVertex(dest);
+    int lo = outOffsets[src], hi = outOffsets[src + 1];
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (outTargets[mid] < dest) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < outOffsets[src + 1] && outTargets[lo] == dest;
+}
+
+// Binary search for the first edge src -> dest, then scan its parallel copies
+Weight DirectedGraph::edgeWeight(int src, int dest) const {
+    checkVertex(src);
+    checkVertex(dest);
+    int end = outOffsets[src + 1];
+    int lo = outOffsets[src], hi = end;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (outTargets[mid] < dest) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == end || outTargets[lo] != dest)
+        throw GraphException("Edge does not exist");
+    if (!outWeights) return 1;
+    Weight best = outWeights[lo];
+    for (int j = lo + 1; j < end && outTargets[j] == dest; ++j) {
+        if (outWeights[j] < best) best = outWeights[j];
+    }
+    return best;
+}
+
+bool DirectedGraph::isUnweighted() const {
+    return outWeights == nullptr;
+}
+
+void DirectedGraph::print_graph() const {
+    for (int u = 0; u < numVertices; ++u) {
+        std::cout << "Vertex " << u << ":";
+        for (int j = outOffsets[u]; j < outOffsets[u + 1]; ++j) {
+            Weight w = outWeights ? outWeights[j] : 1;
+            std::cout << " -> (" << outTargets[j] << ", weight: " << +w << ")";
+        }
+        std::cout << std::endl;
+    }
+}
+
+} // namespace graph
@@ -0,0 +1,104 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "DistanceMatrix.h"
+#include "GraphException.h"
+#include <cstdio>
+
+namespace graph {
+
+static const char MATRIX_TAG[4] = {'G', 'D', 'M', '1'};
+
+DistanceMatrix::DistanceMatrix(int vertices) : n(0), values(nullptr) {
+    if (vertices < 0)
+        throw GraphException("Vertex count must not be negative");
+    n = vertices;
+    long long cells = static_cast<long long>(n) * n;
+    values = new Distance[cells > 0 ? cells : 1];
+    Distance none = UNREACHABLE_DISTANCE;
+    for (long long i = 0; i < cells; ++i) values[i] = none;
+}
+
+DistanceMatrix::~DistanceMatrix() {
+    delete[] values;
+}
+
+DistanceMatrix::DistanceMatrix(DistanceMatrix&& other) : n(other.n), values(other.values) {
+    other.n = 0;
+    other.values = nullptr;
+}
+
+DistanceMatrix& DistanceMatrix::operator=(DistanceMatrix&& other) {
+    if (this != &other) {
+        delete[] values;
+        n = other.n;
+        values = other.values;
+        other.n = 0;
+        other.values = nullptr;
+    }
+    return *this;
+}
+
+void DistanceMatrix::checkVertex(int v) const {
+    if (v < 0 || v >= n)
+        throw GraphException("Vertex index out of bounds");
+}
+
+Distance DistanceMatrix::getDistance(int from, int to) const {
+    checkVertex(from);
+    checkVertex(to);
+    return values[static_cast<long long>(from) * n + to];
+}
+
+bool DistanceMatrix::isReachable(int from, int to) const {
+    return getDistance(from, to) != UNREACHABLE_DISTANCE;
+}
+
+void DistanceMatrix::setDistance(int from, int to, Distance d) {
+    checkVertex(from);
+    checkVertex(to);
+    values[static_cast<long long>(from) * n + to] = d;
+}
+
+const Distance* DistanceMatrix::row(int from) const {
+    checkVertex(from);
+    return values + static_cast<long long>(from) * n;
+}
+
+void DistanceMatrix::save(const char* path) const {
+    FILE* file = std::fopen(path, "wb");
+    if (!file)
+        throw GraphException("Cannot open file for writing");
+    int header[2] = {n, static_cast<int>(sizeof(Distance))};
+    size_t cells = static_cast<size_t>(n) * n;
+    bool ok = std::fwrite(MATRIX_TAG, 1, 4, file) == 4 &&
+              std::fwrite(header, sizeof(int), 2, file) == 2 &&
+              std::fwrite(values, sizeof(Distance), cells, file) == cells;
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok)
+        throw GraphException("Cannot write distance matrix file");
+}
+
+DistanceMatrix DistanceMatrix::load(const char* path) {
+    FILE* file = std::fopen(path, "rb");
+    if (!file)
+        throw GraphException("Cannot open file for reading");
+    char tag[4] = {0, 0, 0, 0};
+    int header[2] = {-1, 0};
+    bool valid = std::fread(tag, 1, 4, file) == 4 && std::fread(header, sizeof(int), 2, file) == 2 &&
+                 tag[0] == MATRIX_TAG[0] && tag[1] == MATRIX_TAG[1] && tag[2] == MATRIX_TAG[2] &&
+                 tag[3] == MATRIX_TAG[3] && header[0] >= 0 && header[1] == static_cast<int>(sizeof(Distance));
+    if (!valid) {
+        std::fclose(file);
+        throw GraphException("Invalid distance matrix file");
+    }
+    DistanceMatrix matrix(header[0]);
+    size_t cells = static_cast<size_t>(header[0]) * header[0];
+    bool complete = std::fread(matrix.values, sizeof(Distance), cells, file) == cells;
+    std::fclose(file);
+    if (!complete)
+        throw GraphException("Invalid distance matrix file");
+    return matrix;
+}
+
+} // namespace graph
@@ -0,0 +1,329 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Eccentricity.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+#include "data_structures/PriorityQueue.h"
+
+namespace graph {
+
+/**
+ * @brief CSR snapshot for repeated single-source searches
+ *
+ * @details Self-loops are dropped since they never shorten a path. With
+ * weighted false every edge counts 1 and searches are BFS; otherwise they
+ * are Dijkstra over the weights. negative records a negative weight so the
+ * caller can throw, and totalWeight is the sum of all edge weights, an
+ * upper bound on any weighted distance.
+ */
+struct DistanceGraph : CsrSnapshot {
+    bool weighted;
+    Distance totalWeight;
+
+    DistanceGraph(const Graph& g, bool useWeights);
+
+    int search(int source, Distance* dist, int* parent, int* reached) const;
+    int components(int* members, int* start) const;
+};
+
+DistanceGraph::DistanceGraph(const Graph& g, bool useWeights)
+    : CsrSnapshot(g, true, true), weighted(useWeights), totalWeight(0) {
+    for (int u = 0; u < n; ++u) {
+        for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+            if (targets[j] > u) totalWeight += weights[j];
+        }
+    }
+}
+
+/**
+ * @brief Distances from source over its component
+ *
+ * @details dist must be UNREACHABLE_DISTANCE everywhere on entry; the
+ * reached vertices are listed in 'reached' (which doubles as the BFS
+ * queue) and the caller resets their dist afterwards, so a search costs
+ * only the size of the component. parent, if given, receives the
+ * predecessor of every reached vertex (-1 for the source). Dijkstra skips
+ * stale heap entries by comparing their priority with the current
+ * distance. Returns the number of reached vertices.
+ */
+int DistanceGraph::search(int source, Distance* dist, int* parent, int* reached) const {
+    int count = 0;
+    dist[source] = 0;
+    if (parent) parent[source] = -1;
+    reached[count++] = source;
+    if (!weighted) {
+        for (int head = 0; head < count; ++head) {
+            int u = reached[head];
+            for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+                int v = targets[j];
+                if (dist[v] != UNREACHABLE_DISTANCE) continue;
+                dist[v] = dist[u] + 1;
+                if (parent) parent[v] = u;
+                reached[count++] = v;
+            }
+        }
+        return count;
+    }
+    PriorityQueue pq(offsets[n] + 1);
+    pq.insert(source, 0);
+    while (!pq.isEmpty()) {
+        Distance d = pq.topPriority();
+        int u = pq.extractMin();
+        if (d > dist[u]) continue;
+        for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+            int v = targets[j];
+            Distance candidate = d + weights[j];
+            if (dist[v] <= candidate) continue;
+            if (dist[v] == UNREACHABLE_DISTANCE) reached[count++] = v;
+            dist[v] = candidate;
+            if (parent) parent[v] = u;
+            pq.insert(v, candidate);
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Group the vertices by connected component
+ *
+ * @details Component c is members[start[c] .. start[c+1]), found by BFS
+ * from its smallest vertex with members as the queue. start needs V + 1
+ * entries. Returns the number of components.
+ */
+int DistanceGraph::components(int* members, int* start) const {
+    bool* seen = new bool[n > 0 ? n : 1]();
+    int count = 0;
+    int c = 0;
+    for (int root = 0; root < n; ++root) {
+        if (seen[root]) continue;
+        start[c++] = count;
+        seen[root] = true;
+        members[count++] = root;
+        for (int head = start[c - 1]; head < count; ++head) {
+            int u = members[head];
+            for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+                if (!seen[targets[j]]) {
+                    seen[targets[j]] = true;
+                    members[count++] = targets[j];
+                }
+            }
+        }
+    }
+    start[c] = count;
+    delete[] seen;
+    return c;
+}
+
+// Farthest of the listed vertices, the first one among ties
+static int farthest(const Distance* dist, const int* reached, int count) {
+    int far = reached[0];
+    for (int i = 1; i < count; ++i) {
+        if (dist[reached[i]] > dist[far]) far = reached[i];
+    }
+    return far;
+}
+
+static void resetDistances(Distance* dist, const int* reached, int count) {
+    for (int i = 0; i < count; ++i) dist[reached[i]] = UNREACHABLE_DISTANCE;
+}
+
+/**
+ * @brief iFUB over every connected component
+ *
+ * @details The double sweep starts at the highest-degree vertex, and its
+ * path's middle vertex is found by walking the parent pointers back from
+ * the far end until half the path length is reached. Of the two, the one
+ * with the smaller eccentricity becomes the root (the hub on ties, which
+ * wins on small-world graphs whose fringe around a path middle is huge).
+ * The component is then fed to a max-heap by distance from the root and
+ * searched one distance class at a time. Each fringe search from
+ * v also bounds ecc(w) <= ecc(v) + d(v, w) for its whole component (upper,
+ * UNREACHABLE_DISTANCE while unknown), and fringe vertices that cannot beat the best
+ * eccentricity found are skipped, as in the bounding method.
+ */
+static Distance ifub(const DistanceGraph& a) {
+    int n = a.n;
+    Distance* dist = new Distance[n > 0 ? n : 1];
+    Distance* fromRoot = new Distance[n > 0 ? n : 1];
+    int* parent = new int[n > 0 ? n : 1];
+    int* reached = new int[n > 0 ? n : 1];
+    int* members = new int[n > 0 ? n : 1];
+    int* start = new int[n + 1];
+    Distance* upper = new Distance[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) dist[v] = fromRoot[v] = upper[v] = UNREACHABLE_DISTANCE;
+    int components = a.components(members, start);
+    Distance best = 0;
+
+    for (int c = 0; c < components; ++c) {
+        int size = start[c + 1] - start[c];
+        if (size < 2) continue;
+        int hub = members[start[c]];
+        for (int i = start[c]; i < start[c + 1]; ++i) {
+            if (a.degree(members[i]) > a.degree(hub)) hub = members[i];
+        }
+        int count = a.search(hub, dist, nullptr, reached);
+        int x = farthest(dist, reached, count);
+        Distance hubEcc = dist[x];
+        resetDistances(dist, reached, count);
+        a.search(x, dist, parent, reached);
+        int y = farthest(dist, reached, count);
+        Distance sweep = dist[y];
+        if (sweep > best) best = sweep;
+        int root = y;
+        while (2 * dist[root] > sweep) root = parent[root];
+        resetDistances(dist, reached, count);
+
+        a.search(root, fromRoot, nullptr, reached);
+        if (hubEcc <= fromRoot[farthest(fromRoot, reached, count)]) {
+            resetDistances(fromRoot, reached, count);
+            root = hub;
+            a.search(root, fromRoot, nullptr, reached);
+        }
+        PriorityQueue fringe(size, true, false);
+        for (int i = 0; i < count; ++i) fringe.insert(reached[i], fromRoot[reached[i]]);
+        if (fringe.topPriority() > best) best = fringe.topPriority();
+        resetDistances(fromRoot, reached, count);
+        while (!fringe.isEmpty()) {
+            Distance level = fringe.topPriority();
+            if (best >= 2 * level) break;
+            while (!fringe.isEmpty() && fringe.topPriority() == level) {
+                int v = fringe.extractTop();
+                if (upper[v] <= best) continue;
+                a.search(v, dist, nullptr, reached);
+                Distance ecc = dist[farthest(dist, reached, count)];
+                if (ecc > best) best = ecc;
+                for (int i = 0; i < count; ++i) {
+                    int w = reached[i];
+                    if (ecc + dist[w] < upper[w]) upper[w] = ecc + dist[w];
+                }
+                resetDistances(dist, reached, count);
+            }
+        }
+    }
+
+    delete[] dist;
+    delete[] fromRoot;
+    delete[] parent;
+    delete[] reached;
+    delete[] members;
+    delete[] start;
+    delete[] upper;
+    return best;
+}
+
+/**
+ * @brief Takes-Kosters eccentricity bounding
+ *
+ * @details Components are bounded one after the other, each until it is
+ * resolved or the budget runs out, so source selection only scans the
+ * current component. Ties between candidate sources go to the higher
+ * degree, which tends to tighten more bounds per search. Every search
+ * resolves at least its source, so a component of size s needs at most s
+ * searches.
+ */
+static int boundEccentricities(const DistanceGraph& a, int searches, Distance initialUpper,
+                               Distance* lower, Distance* upper) {
+    int n = a.n;
+    Distance* dist = new Distance[n > 0 ? n : 1];
+    int* reached = new int[n > 0 ? n : 1];
+    int* members = new int[n > 0 ? n : 1];
+    int* start = new int[n + 1];
+    for (int v = 0; v < n; ++v) {
+        dist[v] = UNREACHABLE_DISTANCE;
+        lower[v] = 0;
+        upper[v] = a.degree(v) == 0 ? 0 : initialUpper;
+    }
+    int components = a.components(members, start);
+    int done = 0;
+    for (int c = 0; c < components && done < searches; ++c) {
+        bool pickUpper = true;
+        while (done < searches) {
+            int source = -1;
+            for (int i = start[c]; i < start[c + 1]; ++i) {
+                int v = members[i];
+                if (lower[v] == upper[v]) continue;
+                if (source == -1) {
+                    source = v;
+                    continue;
+                }
+                bool better = pickUpper ? upper[v] > upper[source] : lower[v] < lower[source];
+                bool tied = pickUpper ? upper[v] == upper[source] : lower[v] == lower[source];
+                if (better || (tied && a.degree(v) > a.degree(source))) source = v;
+            }
+            if (source == -1) break;
+
+            int count = a.search(source, dist, nullptr, reached);
+            Distance ecc = dist[farthest(dist, reached, count)];
+            done++;
+            for (int i = 0; i < count; ++i) {
+                int w = reached[i];
+                Distance low = dist[w] > ecc - dist[w] ? dist[w] : ecc - dist[w];
+                if (low > lower[w]) lower[w] = low;
+                if (ecc + dist[w] < upper[w]) upper[w] = ecc + dist[w];
+            }
+            resetDistances(dist, reached, count);
+            pickUpper = !pickUpper;
+        }
+    }
+    delete[] dist;
+    delete[] reached;
+    delete[] members;
+    delete[] start;
+    return done;
+}
+
+int Eccentricity::diameter(const Graph& g) {
+    DistanceGraph a(g, false);
+    return static_cast<int>(ifub(a));
+}
+
+Distance Eccentricity::weightedDiameter(const Graph& g) {
+    DistanceGraph a(g, true);
+    if (a.negative)
+        throw GraphException("Edge weights must not be negative");
+    return ifub(a);
+}
+
+int Eccentricity::eccentricityBounds(const Graph& g, int searches, int*& lower, int*& upper) {
+    if (searches < 0)
+        throw GraphException("Search count must not be negative");
+    DistanceGraph a(g, false);
+    int n = a.n;
+    Distance* low = new Distance[n > 0 ? n : 1];
+    Distance* high = new Distance[n > 0 ? n : 1];
+    int done = boundEccentricities(a, searches, n - 1, low, high);
+    lower = new int[n > 0 ? n : 1];
+    upper = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) {
+        lower[v] = static_cast<int>(low[v]);
+        upper[v] = static_cast<int>(high[v]);
+    }
+    delete[] low;
+    delete[] high;
+    return done;
+}
+
+int Eccentricity::weightedEccentricityBounds(const Graph& g, int searches,
+                                             Distance*& lower, Distance*& upper) {
+    if (searches < 0)
+        throw GraphException("Search count must not be negative");
+    DistanceGraph a(g, true);
+    if (a.negative)
+        throw GraphException("Edge weights must not be negative");
+    int n = a.n;
+    lower = new Distance[n > 0 ? n : 1];
+    upper = new Distance[n > 0 ? n : 1];
+    return boundEccentricities(a, searches, a.totalWeight, lower, upper);
+}
+
+int* Eccentricity::eccentricities(const Graph& g) {
+    int* lower = nullptr;
+    int* upper = nullptr;
+    eccentricityBounds(g, g.getVertexCount(), lower, upper);
+    delete[] upper;
+    return lower;
+}
+
+} // namespace graph
@@ -3,10 +3,13 @@
 
 #include "Graph.h"
 #include <iostream>
+#include <climits>
 #include "GraphException.h"
 
 namespace graph {
 
+static const int MIN_POOL_NODES = 16;  ///< Initial size of the node pool
+
 /**
  * @brief Constructor - Initialize graph with specified number of vertices
  * 
@@ -14,72 +17,353 @@ namespace graph {
  * adjacency list array where each element points to the head of a linked
  * list containing the neighbors of that vertex.
  * 
- * @details The implementation allocates an array of Node pointers, one for
- * each vertex. Each pointer is initialized to nullptr indicating no edges
- * initially exist.
+ * @details The implementation allocates an array of list heads (node pool
+ * indices), one for each vertex, along with the other per-vertex arrays
+ * (degree, tombstone flags, free-ID stack). Each head is initialized to
+ * NO_NODE indicating no edges initially exist.
  */
-Graph::Graph(int vertices) : numVertices(vertices) {
-    adjacencyList = new Node*[numVertices];
-    for (int i = 0; i < numVertices; ++i) {
-        adjacencyList[i] = nullptr;
-    }
+Graph::Graph(int vertices)
+    : numVertices(0), vertexCapacity(0), activeVertices(vertices), removed(nullptr),
+      freeIds(nullptr), freeIdCount(0), adjacencyList(nullptr), nodes(nullptr),
+      nodeCapacity(0), nodeCount(0), freeNodes(NO_NODE), degree(nullptr), nonUnitNodes(0),
+      edgeIndex(nullptr) {
+    if (vertices < 0)
+        throw GraphException("Vertex count must not be negative");
+    resizeVertexStorage(vertices);
+    numVertices = vertices;
 }
 
 /**
  * @brief Destructor - Clean up all allocated memory
  * 
- * Destroys the graph by first deleting all linked lists (one for each vertex)
- * and then deleting the main adjacency list array. This ensures no memory leaks.
- * 
- * @details For each vertex, deleteList() is called to free the entire linked
- * list of neighbors. Finally, the array of pointers itself is deleted.
+ * Destroys the graph by freeing the node pool (which owns every adjacency
+ * node) and then deleting the per-vertex arrays.
+ * This ensures no memory leaks.
  */
 Graph::~Graph() {
-    for (int i = 0; i < numVertices; ++i) {
-        deleteList(adjacencyList[i]);
+    release();
+}
+
+/**
+ * @brief Move constructor - take over another graph's storage
+ * 
+ * @details Only pointers and counters are copied; no adjacency node or
+ * per-vertex array is touched, so the move is O(1).
+ * 
+ * @param other The graph to move from (left as an empty graph)
+ */
+Graph::Graph(Graph&& other)
+    : numVertices(0), vertexCapacity(0), activeVertices(0), removed(nullptr),
+      freeIds(nullptr), freeIdCount(0), adjacencyList(nullptr), nodes(nullptr),
+      nodeCapacity(0), nodeCount(0), freeNodes(NO_NODE), degree(nullptr), nonUnitNodes(0),
+      edgeIndex(nullptr) {
+    takeFrom(other);
+}
+
+/**
+ * @brief Move assignment - release own storage and take over another's
+ * 
+ * @param other The graph to move from (left as an empty graph)
+ * @return Reference to this graph
+ */
+Graph& Graph::operator=(Graph&& other) {
+    if (this != &other) {
+        release();
+        takeFrom(other);
+    }
+    return *this;
+}
+
+/**
+ * @brief Create an explicit deep copy of the graph
+ * 
+ * @details The total number of adjacency nodes is known from the degree
+ * counters, so the copy's node pool is allocated at exactly that size.
+ * Each vertex's list is copied in order into consecutive nodes of the
+ * pool, which gives the copy better locality than the (possibly
+ * fragmented) original.
+ * 
+ * @return An independent copy of this graph
+ */
+Graph Graph::clone() const {
+    Graph copy(0);
+    copy.resizeVertexStorage(vertexCapacity);
+    copy.numVertices = numVertices;
+    copy.activeVertices = activeVertices;
+    copy.freeIdCount = freeIdCount;
+    copy.nonUnitNodes = nonUnitNodes;
+    for (int i = 0; i < freeIdCount; ++i) {
+        copy.freeIds[i] = freeIds[i];
+    }
+
+    int total = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        total += degree[v];
     }
+    copy.reserveNodes(total);
+    copy.nodeCount = total;
+
+    int next = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        copy.removed[v] = removed[v];
+        copy.degree[v] = degree[v];
+        int prev = NO_NODE;
+        for (int node = adjacencyList[v]; node != NO_NODE; node = nodes[node].next) {
+            Node* dup = &copy.nodes[next];
+            dup->vertex = nodes[node].vertex;
+            setNodeWeight(dup, nodeWeight(&nodes[node]));
+            dup->prev = prev;
+            dup->next = NO_NODE;
+            if (prev != NO_NODE) copy.nodes[prev].next = next;
+            else copy.adjacencyList[v] = next;
+            prev = next++;
+        }
+    }
+
+    if (edgeIndex != nullptr) copy.enableEdgeIndex();
+    return copy;
+}
+
+/**
+ * @brief Free all storage owned by the graph
+ * 
+ * @details Frees the edge index, the node pool and the per-vertex arrays,
+ * then resets every member so the object is a valid empty graph.
+ */
+void Graph::release() {
+    disableEdgeIndex();
+    delete[] nodes;
+    nodes = nullptr;
+    nodeCapacity = 0;
+    nodeCount = 0;
+    freeNodes = NO_NODE;
     delete[] adjacencyList;
+    delete[] degree;
+    delete[] removed;
+    delete[] freeIds;
+    adjacencyList = nullptr;
+    degree = nullptr;
+    removed = nullptr;
+    freeIds = nullptr;
+    nonUnitNodes = 0;
+    numVertices = 0;
+    vertexCapacity = 0;
+    activeVertices = 0;
+    freeIdCount = 0;
+}
+
+/**
+ * @brief Take over the storage of another graph and reset it to empty
+ * 
+ * @details Assumes this graph currently owns no storage (freshly constructed
+ * or released).
+ * 
+ * @param other The graph whose storage is taken
+ */
+void Graph::takeFrom(Graph& other) {
+    numVertices = other.numVertices;
+    vertexCapacity = other.vertexCapacity;
+    activeVertices = other.activeVertices;
+    removed = other.removed;
+    freeIds = other.freeIds;
+    freeIdCount = other.freeIdCount;
+    adjacencyList = other.adjacencyList;
+    nodes = other.nodes;
+    nodeCapacity = other.nodeCapacity;
+    nodeCount = other.nodeCount;
+    freeNodes = other.freeNodes;
+    degree = other.degree;
+    nonUnitNodes = other.nonUnitNodes;
+    edgeIndex = other.edgeIndex;
+
+    other.numVertices = 0;
+    other.vertexCapacity = 0;
+    other.activeVertices = 0;
+    other.removed = nullptr;
+    other.freeIds = nullptr;
+    other.freeIdCount = 0;
+    other.adjacencyList = nullptr;
+    other.nodes = nullptr;
+    other.nodeCapacity = 0;
+    other.nodeCount = 0;
+    other.freeNodes = NO_NODE;
+    other.degree = nullptr;
+    other.nonUnitNodes = 0;
+    other.edgeIndex = nullptr;
 }
 
 /**
  * @brief Create a new node for the adjacency list
  * 
- * Helper function to create and initialize a new Node structure with the
- * given vertex and weight values. The next pointer is set to nullptr.
+ * Helper function to take a node from the pool and initialize it with the
+ * given vertex and weight values. The next link is set to NO_NODE.
  * 
- * @details This function encapsulates node creation to ensure consistent
- * initialization and makes the code more maintainable.
+ * @details Released nodes are reused first. Otherwise the next unused node of
+ * the pool is handed out, and the pool doubles in size when it is exhausted,
+ * so the number of allocations grows logarithmically with the number of edges.
  * 
  * @param vertex The destination vertex this node represents
  * @param weight The weight of the edge to this vertex
- * @return Pointer to the newly created and initialized node
+ * @return Pool index of the newly created and initialized node
  */
-Graph::Node* Graph::createNode(int vertex, int weight) {
-    Node* newNode = new Node;
+int Graph::createNode(int vertex, Weight weight) {
+    int index;
+    if (freeNodes != NO_NODE) {
+        index = freeNodes;
+        freeNodes = nodes[index].next;
+    } else {
+        if (nodeCount == nodeCapacity) reserveNodes(1);
+        index = nodeCount++;
+    }
+    Node* newNode = &nodes[index];
     newNode->vertex = vertex;
-    newNode->weight = weight;
-    newNode->next = nullptr;
-    return newNode;
+    setNodeWeight(newNode, weight);
+    newNode->next = NO_NODE;
+    newNode->prev = NO_NODE;
+    return index;
 }
 
 /**
- * @brief Delete an entire linked list starting from the given head
+ * @brief Return a node to the pool
  * 
- * Helper function to recursively delete all nodes in a linked list.
- * Used during destruction and edge removal operations.
+ * Pushes the node onto the free list so that the next createNode() call
+ * reuses it instead of taking a fresh node from the pool.
  * 
- * @details Iterates through the linked list, deleting each node while
- * advancing to the next node. This prevents memory leaks when removing
- * adjacency lists.
+ * @param node Pool index of the node to release
+ */
+void Graph::releaseNode(int node) {
+    nodes[node].next = freeNodes;
+    freeNodes = node;
+}
+
+/**
+ * @brief Grow the node pool so that 'extra' more nodes fit after nodeCount
+ * 
+ * @details The pool at least doubles, so repeated growth is amortized O(1)
+ * per node. Nodes refer to each other by index, so they can be copied into
+ * the larger array as they are.
  * 
- * @param head Pointer to the head of the list to delete
+ * @param extra Number of nodes that must fit
+ * @throws GraphException if the pool would exceed INT_MAX nodes
  */
-void Graph::deleteList(Node* head) {
-    while (head != nullptr) {
-        Node* temp = head;
-        head = head->next;
-        delete temp;
+void Graph::reserveNodes(int extra) {
+    long long needed = static_cast<long long>(nodeCount) + extra;
+    if (needed <= nodeCapacity) return;
+    if (needed > INT_MAX)
+        throw GraphException("Too many edges");
+    long long capacity = nodeCapacity < MIN_POOL_NODES ? MIN_POOL_NODES : 2LL * nodeCapacity;
+    if (capacity < needed) capacity = needed;
+    if (capacity > INT_MAX) capacity = INT_MAX;
+
+    Node* grown = new Node[capacity];
+    for (int i = 0; i < nodeCount; ++i) {
+        grown[i] = nodes[i];
+    }
+    delete[] nodes;
+    nodes = grown;
+    nodeCapacity = static_cast<int>(capacity);
+}
+
+/**
+ * @brief Validate a vertex index
+ * 
+ * @param vertex The vertex index to check
+ * @throws GraphException if vertex is out of bounds
+ */
+void Graph::checkVertex(int vertex) const {
+    if (vertex < 0 || vertex >= numVertices)
+        throw GraphException("Vertex index out of bounds");
+}
+
+/**
+ * @brief Validate a vertex index and make sure it has not been removed
+ * 
+ * @param vertex The vertex index to check
+ * @throws GraphException if vertex is out of bounds or removed
+ */
+void Graph::checkActiveVertex(int vertex) const {
+    checkVertex(vertex);
+    if (removed[vertex])
+        throw GraphException("Vertex has been removed");
+}
+
+/**
+ * @brief Reallocate all per-vertex arrays with a new capacity
+ * 
+ * @details Copies the entries of the current ID range into freshly allocated
+ * arrays and initializes the remaining slots as empty, live vertices.
+ * 
+ * @param capacity The new capacity (must be >= numVertices)
+ */
+void Graph::resizeVertexStorage(int capacity) {
+    int* newAdjacency = new int[capacity];
+    int* newDegree = new int[capacity];
+    bool* newRemoved = new bool[capacity];
+    int* newFreeIds = new int[capacity];
+    EdgeIndex** newIndex = edgeIndex != nullptr ? new EdgeIndex*[capacity] : nullptr;
+
+    for (int v = 0; v < capacity; ++v) {
+        bool old = v < numVertices;
+        newAdjacency[v] = old ? adjacencyList[v] : NO_NODE;
+        newDegree[v] = old ? degree[v] : 0;
+        newRemoved[v] = old ? removed[v] : false;
+        if (newIndex != nullptr) newIndex[v] = old ? edgeIndex[v] : nullptr;
     }
+    for (int i = 0; i < freeIdCount; ++i) {
+        newFreeIds[i] = freeIds[i];
+    }
+
+    delete[] adjacencyList;
+    delete[] degree;
+    delete[] removed;
+    delete[] freeIds;
+    delete[] edgeIndex;
+    adjacencyList = newAdjacency;
+    degree = newDegree;
+    removed = newRemoved;
+    freeIds = newFreeIds;
+    edgeIndex = newIndex;
+    vertexCapacity = capacity;
+}
+
+/**
+ * @brief Insert a node at the head of a vertex's adjacency list
+ * 
+ * @details Head insertion keeps this O(1). The degree counter and the
+ * owner's edge index (if any) are updated along with the list.
+ * 
+ * @param owner Vertex whose list receives the node
+ * @param node Pool index of the node to insert
+ */
+void Graph::linkNode(int owner, int node) {
+    Node* linked = &nodes[node];
+    linked->prev = NO_NODE;
+    linked->next = adjacencyList[owner];
+    if (linked->next != NO_NODE) nodes[linked->next].prev = node;
+    adjacencyList[owner] = node;
+    degree[owner]++;
+    if (nodeWeight(linked) != 1) nonUnitNodes++;
+    indexInsert(owner, node, 1);
+}
+
+/**
+ * @brief Remove a node from a vertex's adjacency list and release it
+ * 
+ * @details Because the list is doubly linked, the node is unlinked in O(1)
+ * without searching for its predecessor.
+ * 
+ * @param owner Vertex whose list contains the node
+ * @param node Pool index of the node to remove
+ */
+void Graph::unlinkNode(int owner, int node) {
+    indexErase(owner, node);
+    Node* unlinked = &nodes[node];
+    if (unlinked->prev != NO_NODE) nodes[unlinked->prev].next = unlinked->next;
+    else adjacencyList[owner] = unlinked->next;
+    if (unlinked->next != NO_NODE) nodes[unlinked->next].prev = unlinked->prev;
+    degree[owner]--;
+    if (nodeWeight(unlinked) != 1) nonUnitNodes--;
+    releaseNode(node);
 }
 
 /**
@@ -96,68 +380,523 @@ void Graph::deleteList(Node* head) {
  * @param src Source vertex index (0-based)
  * @param dest Destination vertex index (0-based)  
  * @param weight Weight of the edge (default: 1)
- * @throws std::out_of_range if vertex indices are invalid
+ * @throws GraphException if vertex indices are invalid
  */
-void Graph::addEdge(int src, int dest, int weight) {
-    if (src < 0 || src >= numVertices || dest < 0 || dest >= numVertices) 
-        throw GraphException("Vertex index out of bounds");
+void Graph::addEdge(int src, int dest, Weight weight) {
+    checkActiveVertex(src);
+    checkActiveVertex(dest);
 
     // Add edge from src to dest
-    Node* newNode = createNode(dest, weight);
-    newNode->next = adjacencyList[src];
-    adjacencyList[src] = newNode;
+    linkNode(src, createNode(dest, weight));
 
     // Add edge from dest to src (undirected graph)
-    newNode = createNode(src, weight);
-    newNode->next = adjacencyList[dest];
-    adjacencyList[dest] = newNode;
+    linkNode(dest, createNode(src, weight));
+}
+
+/**
+ * @brief Add a batch of undirected edges in a single call
+ * 
+ * Validates every triple first, then counts how many new half-edges each
+ * vertex receives and places all of them in one contiguous run of the pool.
+ * 
+ * @details The run is partitioned by a prefix sum over the per-vertex
+ * counts (a counting sort by endpoint), so the new nodes of each vertex are
+ * stored consecutively. Each vertex's run is then chained in batch order
+ * and spliced in front of its existing adjacency list, so a vertex lists
+ * its new edges before its older ones, like addEdge(), but lists the batch
+ * itself first to last (addEdge() calls list the newest edge first).
+ * 
+ * @param edges Array of (src, dest, weight) triples
+ * @param count Number of triples in the array
+ * @throws GraphException if count is negative or any vertex is invalid or removed
+ */
+void Graph::addEdges(const Edge* edges, int count) {
+    if (count < 0 || count > INT_MAX / 2)
+        throw GraphException("Invalid edge count");
+    for (int i = 0; i < count; ++i) {
+        checkActiveVertex(edges[i].src);
+        checkActiveVertex(edges[i].dest);
+    }
+    if (count == 0) return;
+
+    // Count new half-edges per vertex and turn the counts into start offsets
+    int* offset = new int[numVertices + 1]();
+    for (int i = 0; i < count; ++i) {
+        offset[edges[i].src + 1]++;
+        offset[edges[i].dest + 1]++;
+    }
+    for (int v = 0; v < numVertices; ++v) {
+        offset[v + 1] += offset[v];
+    }
+
+    reserveNodes(2 * count);
+    int base = nodeCount;
+    nodeCount += 2 * count;
+
+    // Scatter both directions of every edge into the owning vertex's run
+    int* fill = new int[numVertices];
+    for (int v = 0; v < numVertices; ++v) {
+        offset[v] += base;
+        fill[v] = offset[v];
+    }
+    offset[numVertices] += base;
+    for (int i = 0; i < count; ++i) {
+        Node* node = &nodes[fill[edges[i].src]++];
+        node->vertex = edges[i].dest;
+        setNodeWeight(node, edges[i].weight);
+        node = &nodes[fill[edges[i].dest]++];
+        node->vertex = edges[i].src;
+        setNodeWeight(node, edges[i].weight);
+        if (nodeWeight(node) != 1) nonUnitNodes += 2;
+    }
+
+    // Chain each run and splice it in front of the existing list
+    for (int v = 0; v < numVertices; ++v) {
+        int first = offset[v];
+        int last = offset[v + 1] - 1;
+        if (first > last) continue;
+        nodes[first].prev = NO_NODE;
+        for (int j = first; j < last; ++j) {
+            nodes[j].next = j + 1;
+            nodes[j + 1].prev = j;
+        }
+        nodes[last].next = adjacencyList[v];
+        if (adjacencyList[v] != NO_NODE) nodes[adjacencyList[v]].prev = last;
+        adjacencyList[v] = first;
+        degree[v] += last - first + 1;
+        indexInsert(v, first, last - first + 1);
+    }
+
+    delete[] offset;
+    delete[] fill;
+}
+
+/**
+ * @brief Reserve node storage for a number of upcoming edges
+ * 
+ * @details Grows the node pool now if it cannot hold both half-edges of
+ * 'count' more edges, so subsequent addEdge() calls are served without
+ * touching the allocator.
+ * 
+ * @param count Number of undirected edges to reserve room for
+ * @throws GraphException if count is negative
+ */
+void Graph::reserveEdges(int count) {
+    if (count < 0 || count > INT_MAX / 2)
+        throw GraphException("Invalid edge count");
+    reserveNodes(2 * count);
 }
 
 /**
  * @brief Remove an undirected edge between two vertices
  * 
- * Removes the edge between source and destination vertices by searching
- * and deleting the corresponding nodes from both adjacency lists.
+ * Removes the edge between source and destination vertices by locating
+ * and unlinking the corresponding nodes from both adjacency lists.
  * 
- * @details The implementation uses pointer-to-pointer technique for efficient
- * node removal without special handling for head node. Searches both adjacency
- * lists and removes the first occurrence of each edge direction.
+ * @details Both halves are located with findNode(), which probes the edge
+ * index of high-degree vertices and scans the list otherwise. The second
+ * half is matched on weight so that parallel edges stay consistent.
  * 
  * @param src Source vertex index (0-based)
  * @param dest Destination vertex index (0-based)
- * @throws std::out_of_range if vertex indices are invalid
+ * @throws GraphException if vertex indices are invalid
  * 
  * @note If the edge doesn't exist, the operation completes without error
  */
 void Graph::removeEdge(int src, int dest) {
-    if (src < 0 || src >= numVertices || dest < 0 || dest >= numVertices) 
-        throw GraphException("Vertex index out of bounds");
+    checkVertex(src);
+    checkVertex(dest);
+
+    int half = findNode(src, dest);
+    if (half == NO_NODE) return;
+    int twin = findTwin(src, dest, half);
 
-    // Remove edge from src to dest
-    Node** current = &adjacencyList[src];
-    while (*current) {
-        if ((*current)->vertex == dest) {
-            Node* temp = *current;
-            *current = (*current)->next;
-            delete temp;
-            break;
+    // Remove edge from src to dest, then from dest to src (undirected graph)
+    unlinkNode(src, half);
+    if (twin != NO_NODE) unlinkNode(dest, twin);
+}
+
+/**
+ * @brief Check whether an edge exists between two vertices
+ * 
+ * @param src Source vertex index (0-based)
+ * @param dest Destination vertex index (0-based)
+ * @return true if the edge exists, false otherwise
+ * @throws GraphException if vertex indices are invalid
+ */
+bool Graph::hasEdge(int src, int dest) const {
+    checkVertex(src);
+    checkVertex(dest);
+    return locateEdge(src, dest) != NO_NODE;
+}
+
+/**
+ * @brief Get the weight of the edge between two vertices
+ * 
+ * @param src Source vertex index (0-based)
+ * @param dest Destination vertex index (0-based)
+ * @return The weight stored on the edge
+ * @throws GraphException if vertex indices are invalid or the edge does not exist
+ */
+Weight Graph::edgeWeight(int src, int dest) const {
+    checkVertex(src);
+    checkVertex(dest);
+    int node = locateEdge(src, dest);
+    if (node == NO_NODE)
+        throw GraphException("Edge does not exist");
+    return nodeWeight(&nodes[node]);
+}
+
+/**
+ * @brief Change the weight of the edge between two vertices
+ * 
+ * @details Locates the half-edge in src's list and its twin in dest's list
+ * and overwrites the weight on both.
+ * 
+ * @param src Source vertex index (0-based)
+ * @param dest Destination vertex index (0-based)
+ * @param weight The new edge weight
+ * @throws GraphException if vertex indices are invalid or the edge does not exist
+ */
+void Graph::updateWeight(int src, int dest, Weight weight) {
+    checkVertex(src);
+    checkVertex(dest);
+    int half = findNode(src, dest);
+    if (half == NO_NODE)
+        throw GraphException("Edge does not exist");
+    int twin = findTwin(src, dest, half);
+    int halves[2] = {half, twin};
+    for (int i = 0; i < 2; ++i) {
+        if (halves[i] == NO_NODE) continue;
+        Node* node = &nodes[halves[i]];
+        if (nodeWeight(node) != 1) nonUnitNodes--;
+        setNodeWeight(node, weight);
+        if (nodeWeight(node) != 1) nonUnitNodes++;
+    }
+}
+
+/**
+ * @brief Hash a neighbor ID to a slot of an edge index table
+ * 
+ * @details Multiplicative (Fibonacci) hashing followed by folding the high
+ * bits down, so that consecutive IDs spread over the whole table.
+ * 
+ * @param key The neighbor vertex ID
+ * @param capacity The table capacity (power of two)
+ * @return Slot index in [0, capacity)
+ */
+static int hashSlot(int key, int capacity) {
+    unsigned int h = static_cast<unsigned int>(key) * 2654435769u;
+    h ^= h >> 16;
+    return static_cast<int>(h & static_cast<unsigned int>(capacity - 1));
+}
+
+/**
+ * @brief Locate an adjacency node of 'owner' pointing to 'target'
+ * 
+ * @details With an edge index the probe sequence for 'target' is walked
+ * until an empty slot; otherwise the adjacency list is scanned. The first
+ * node matching the weight (if requested) wins, with the first node for
+ * the target as fallback.
+ * 
+ * @return Pool index of the node found, or NO_NODE if there is none
+ */
+int Graph::findNode(int owner, int target, Weight weight, bool matchWeight, int skip) const {
+    int fallback = NO_NODE;
+    EdgeIndex* index = edgeIndex != nullptr ? edgeIndex[owner] : nullptr;
+    if (index != nullptr) {
+        int mask = index->capacity - 1;
+        for (int i = hashSlot(target, index->capacity); index->slots[i] != NO_NODE; i = (i + 1) & mask) {
+            int node = index->slots[i];
+            if (nodes[node].vertex != target || node == skip) continue;
+            if (!matchWeight || nodeWeight(&nodes[node]) == weight) return node;
+            if (fallback == NO_NODE) fallback = node;
         }
-        current = &((*current)->next);
+    } else {
+        for (int node = adjacencyList[owner]; node != NO_NODE; node = nodes[node].next) {
+            if (nodes[node].vertex != target || node == skip) continue;
+            if (!matchWeight || nodeWeight(&nodes[node]) == weight) return node;
+            if (fallback == NO_NODE) fallback = node;
+        }
+    }
+    return fallback;
+}
+
+/**
+ * @brief Find the second half of an undirected edge
+ * 
+ * @details For a self-loop both halves live in the same list, so the first
+ * half is skipped explicitly.
+ */
+int Graph::findTwin(int src, int dest, int half) const {
+    return findNode(dest, src, nodeWeight(&nodes[half]), true, src == dest ? half : NO_NODE);
+}
+
+/**
+ * @brief Locate one half of an edge from the cheaper endpoint
+ * 
+ * @details Prefers an endpoint that has an edge index; if neither (or both)
+ * do, searches the endpoint with the shorter adjacency list.
+ */
+int Graph::locateEdge(int src, int dest) const {
+    bool srcIndexed = edgeIndex != nullptr && edgeIndex[src] != nullptr;
+    bool destIndexed = edgeIndex != nullptr && edgeIndex[dest] != nullptr;
+    if (destIndexed && !srcIndexed) return findNode(dest, src);
+    if (srcIndexed == destIndexed && degree[dest] < degree[src]) return findNode(dest, src);
+    return findNode(src, dest);
+}
+
+/**
+ * @brief Build the hash table of a single vertex from its adjacency list
+ * 
+ * @details The table is sized to the smallest power of two that keeps the
+ * load factor at or below one half, then every node of the list is inserted.
+ * Any previous table of the vertex is discarded.
+ * 
+ * @param owner The vertex to index
+ */
+void Graph::buildIndex(int owner) {
+    EdgeIndex* index = edgeIndex[owner];
+    if (index == nullptr) {
+        index = new EdgeIndex;
+        edgeIndex[owner] = index;
+    } else {
+        delete[] index->slots;
+    }
+    index->capacity = 2 * INDEX_MIN_DEGREE;
+    while (index->capacity < 2 * degree[owner]) index->capacity *= 2;
+    index->size = 0;
+    index->slots = new int[index->capacity];
+    for (int i = 0; i < index->capacity; ++i) {
+        index->slots[i] = NO_NODE;
     }
 
-    // Remove edge from dest to src (undirected graph)
-    current = &adjacencyList[dest];
-    while (*current) {
-        if ((*current)->vertex == src) {
-            Node* temp = *current;
-            *current = (*current)->next;
-            delete temp;
-            break;
+    int mask = index->capacity - 1;
+    for (int node = adjacencyList[owner]; node != NO_NODE; node = nodes[node].next) {
+        int i = hashSlot(nodes[node].vertex, index->capacity);
+        while (index->slots[i] != NO_NODE) i = (i + 1) & mask;
+        index->slots[i] = node;
+        index->size++;
+    }
+}
+
+/**
+ * @brief Add consecutive list nodes to their owner's hash table
+ * 
+ * @details The nodes must already be linked into the list and counted in
+ * degree[]. If the table is missing (and the degree threshold is reached)
+ * or would exceed a load factor of one half, it is rebuilt from the list,
+ * which covers the new nodes as well.
+ */
+void Graph::indexInsert(int owner, int first, int count) {
+    if (edgeIndex == nullptr) return;
+    EdgeIndex* index = edgeIndex[owner];
+    if (index == nullptr) {
+        if (degree[owner] >= INDEX_MIN_DEGREE) buildIndex(owner);
+        return;
+    }
+    if (2 * (index->size + count) > index->capacity) {
+        buildIndex(owner);
+        return;
+    }
+    int mask = index->capacity - 1;
+    int node = first;
+    for (int k = 0; k < count; ++k, node = nodes[node].next) {
+        int i = hashSlot(nodes[node].vertex, index->capacity);
+        while (index->slots[i] != NO_NODE) i = (i + 1) & mask;
+        index->slots[i] = node;
+        index->size++;
+    }
+}
+
+/**
+ * @brief Remove a node from its owner's hash table
+ * 
+ * @details Uses backward-shift deletion: after clearing the slot, later
+ * entries of the same probe run are moved back into the gap whenever their
+ * home slot does not lie between the gap and their current slot. This keeps
+ * probe sequences intact without tombstones.
+ */
+void Graph::indexErase(int owner, int node) {
+    if (edgeIndex == nullptr || edgeIndex[owner] == nullptr) return;
+    EdgeIndex* index = edgeIndex[owner];
+    int mask = index->capacity - 1;
+    int i = hashSlot(nodes[node].vertex, index->capacity);
+    while (index->slots[i] != node) i = (i + 1) & mask;
+
+    index->slots[i] = NO_NODE;
+    index->size--;
+    for (int j = (i + 1) & mask; index->slots[j] != NO_NODE; j = (j + 1) & mask) {
+        int home = hashSlot(nodes[index->slots[j]].vertex, index->capacity);
+        bool inRange = i < j ? (home > i && home <= j) : (home > i || home <= j);
+        if (!inRange) {
+            index->slots[i] = index->slots[j];
+            index->slots[j] = NO_NODE;
+            i = j;
         }
-        current = &((*current)->next);
     }
 }
 
+/**
+ * @brief Check whether every edge of the graph has weight 1
+ * 
+ * @details Relies on the count of adjacency nodes whose weight differs from
+ * 1, which every insertion, removal and weight update keeps current. In
+ * GRAPH_UNWEIGHTED builds that count is always zero.
+ * 
+ * @return true if no edge has a weight other than 1
+ */
+bool Graph::isUnweighted() const {
+    return nonUnitNodes == 0;
+}
+
+/**
+ * @brief Enable the per-vertex edge index
+ * 
+ * @details Allocates the per-vertex table array and builds a table for every
+ * vertex whose degree is already at least INDEX_MIN_DEGREE. Other vertices
+ * get a table later, when insertions push them over the threshold. The
+ * array covers the whole vertex capacity, since addVertex() can extend the
+ * ID range into spare capacity without reallocating.
+ */
+void Graph::enableEdgeIndex() {
+    if (edgeIndex != nullptr) return;
+    edgeIndex = new EdgeIndex*[vertexCapacity > 0 ? vertexCapacity : 1]();
+    for (int v = 0; v < numVertices; ++v) {
+        if (degree[v] >= INDEX_MIN_DEGREE) buildIndex(v);
+    }
+}
+
+/**
+ * @brief Disable the per-vertex edge index and free its memory
+ */
+void Graph::disableEdgeIndex() {
+    if (edgeIndex == nullptr) return;
+    for (int v = 0; v < numVertices; ++v) {
+        if (edgeIndex[v] != nullptr) {
+            delete[] edgeIndex[v]->slots;
+            delete edgeIndex[v];
+        }
+    }
+    delete[] edgeIndex;
+    edgeIndex = nullptr;
+}
+
+/**
+ * @brief Check whether the per-vertex edge index is enabled
+ * 
+ * @return true if enableEdgeIndex() is in effect
+ */
+bool Graph::isEdgeIndexEnabled() const {
+    return edgeIndex != nullptr;
+}
+
+/**
+ * @brief Add a new isolated vertex to the graph
+ * 
+ * @details Pops a recycled ID from the free-ID stack when available.
+ * Otherwise the ID range is extended by one, doubling the capacity of all
+ * per-vertex arrays when it is exhausted.
+ * 
+ * @return The ID of the new vertex
+ */
+int Graph::addVertex() {
+    int vertex;
+    if (freeIdCount > 0) {
+        vertex = freeIds[--freeIdCount];
+        removed[vertex] = false;
+    } else {
+        if (numVertices == vertexCapacity) {
+            resizeVertexStorage(vertexCapacity == 0 ? 1 : 2 * vertexCapacity);
+        }
+        vertex = numVertices++;
+    }
+    activeVertices++;
+    return vertex;
+}
+
+/**
+ * @brief Remove a vertex and all of its incident edges
+ * 
+ * @details Every node in the vertex's list is unlinked together with its
+ * twin in the neighbor's list (located through the neighbor's edge index
+ * when it has one). The emptied vertex is then tombstoned and its ID pushed
+ * onto the free-ID stack.
+ * 
+ * @param vertex The vertex to remove (0-based index)
+ * @throws GraphException if vertex is invalid or already removed
+ */
+void Graph::removeVertex(int vertex) {
+    checkActiveVertex(vertex);
+
+    while (adjacencyList[vertex] != NO_NODE) {
+        int half = adjacencyList[vertex];
+        int neighbor = nodes[half].vertex;
+        int twin = findTwin(vertex, neighbor, half);
+        unlinkNode(vertex, half);
+        if (twin != NO_NODE) unlinkNode(neighbor, twin);
+    }
+
+    if (edgeIndex != nullptr && edgeIndex[vertex] != nullptr) {
+        delete[] edgeIndex[vertex]->slots;
+        delete edgeIndex[vertex];
+        edgeIndex[vertex] = nullptr;
+    }
+    removed[vertex] = true;
+    freeIds[freeIdCount++] = vertex;
+    activeVertices--;
+}
+
+/**
+ * @brief Check whether a vertex ID refers to a live vertex
+ * 
+ * @param vertex The vertex ID to check
+ * @return true if the ID is in range and has not been removed
+ */
+bool Graph::hasVertex(int vertex) const {
+    return vertex >= 0 && vertex < numVertices && !removed[vertex];
+}
+
+/**
+ * @brief Renumber the live vertices densely
+ * 
+ * @details Assigns new IDs in increasing order of old ID, rewrites the
+ * vertex field of every adjacency node through the mapping, and moves the
+ * list heads into exactly-sized per-vertex arrays. The edge index, if
+ * enabled, is rebuilt since its keys have changed.
+ * 
+ * @return Mapping from old ID to new ID, -1 for removed IDs (caller deletes)
+ */
+int* Graph::compact() {
+    int oldCount = numVertices;
+    int* mapping = new int[oldCount];
+    int next = 0;
+    for (int v = 0; v < oldCount; ++v) {
+        mapping[v] = removed[v] ? -1 : next++;
+    }
+
+    for (int v = 0; v < oldCount; ++v) {
+        for (int node = adjacencyList[v]; node != NO_NODE; node = nodes[node].next) {
+            nodes[node].vertex = mapping[nodes[node].vertex];
+        }
+    }
+
+    bool indexed = edgeIndex != nullptr;
+    disableEdgeIndex();
+    for (int v = 0; v < oldCount; ++v) {
+        if (mapping[v] == -1) continue;
+        adjacencyList[mapping[v]] = adjacencyList[v];
+        degree[mapping[v]] = degree[v];
+        removed[mapping[v]] = false;
+    }
+    numVertices = next;
+    freeIdCount = 0;
+    resizeVertexStorage(next);
+    if (indexed) enableEdgeIndex();
+
+    return mapping;
+}
+
 /**
  * @brief Print the graph's adjacency list representation
  * 
@@ -170,11 +909,11 @@ void Graph::removeEdge(int src, int dest) {
  */
 void Graph::print_graph() const {
     for (int i = 0; i < numVertices; ++i) {
+        if (removed[i]) continue;
         std::cout << "Vertex " << i << ":";
-        Node* temp = adjacencyList[i];
-        while (temp) {
-            std::cout << " -> (" << temp->vertex << ", weight: " << temp->weight << ")";
-            temp = temp->next;
+        for (int node = adjacencyList[i]; node != NO_NODE; node = nodes[node].next) {
+            // Unary plus prints single-byte weight types as numbers, not characters
+            std::cout << " -> (" << nodes[node].vertex << ", weight: " << +nodeWeight(&nodes[node]) << ")";
         }
         std::cout << std::endl;
     }
@@ -183,8 +922,8 @@ void Graph::print_graph() const {
 /**
  * @brief Get the total number of vertices in the graph
  * 
- * Simple getter method that returns the number of vertices that was
- * set during graph construction.
+ * Simple getter method that returns the size of the vertex ID range.
+ * Removed IDs that have not been reused are still counted.
  * 
  * @return The total number of vertices in the graph
  */
@@ -192,6 +931,30 @@ int Graph::getVertexCount() const {
     return numVertices;
 }
 
+/**
+ * @brief Get the number of live (not removed) vertices
+ * 
+ * @return The number of vertices that have not been removed
+ */
+int Graph::getActiveVertexCount() const {
+    return activeVertices;
+}
+
+/**
+ * @brief Get the number of adjacency entries of a vertex
+ * 
+ * The degree is maintained on every insertion and removal, so no list
+ * traversal is needed.
+ * 
+ * @param vertex The vertex to query (0-based index)
+ * @return Number of neighbors of the vertex
+ * @throws GraphException if vertex index is invalid
+ */
+int Graph::getDegree(int vertex) const {
+    checkVertex(vertex);
+    return degree[vertex];
+}
+
 /**
  * @brief Get all neighbors of a specific vertex as an array
  * 
@@ -199,42 +962,65 @@ int Graph::getVertexCount() const {
  * all adjacent vertices and their edge weights. The caller must delete the
  * returned array to prevent memory leaks.
  * 
- * @details The implementation makes two passes: first to count neighbors,
- * then to populate the array. This approach avoids using dynamic containers
- * while providing a clean interface to the caller.
+ * @details The array is sized from the maintained degree counter and then
+ * populated in a single pass over the list. This approach avoids using
+ * dynamic containers while providing a clean interface to the caller.
  * 
  * @param vertex The vertex whose neighbors to retrieve (0-based index)
  * @param count Reference parameter to store the number of neighbors found
  * @return Dynamically allocated array of Neighbor structures
- * @throws std::out_of_range if vertex index is invalid
+ * @throws GraphException if vertex index is invalid
  * 
  * @warning The caller is responsible for deleting the returned array using delete[]
  */
 Neighbor* Graph::getNeighbors(int vertex, int& count) const {
-    if (vertex < 0 || vertex >= numVertices) 
-        throw GraphException("Vertex index out of bounds");
+    checkVertex(vertex);
 
-    count = 0;
-    Node* temp = adjacencyList[vertex];
-
-    // First pass: count neighbors
-    while (temp) {
-        count++;
-        temp = temp->next;
-    }
+    // The degree counter gives the array size without a counting pass
+    count = degree[vertex];
 
     // Allocate array and populate with neighbor data
     Neighbor* neighbors = new Neighbor[count];
-    temp = adjacencyList[vertex];
     int i = 0;
-    while (temp) {
-        neighbors[i].vertex = temp->vertex;
-        neighbors[i].weight = temp->weight;
-        temp = temp->next;
+    for (int node = adjacencyList[vertex]; node != NO_NODE; node = nodes[node].next) {
+        neighbors[i].vertex = nodes[node].vertex;
+        neighbors[i].weight = nodeWeight(&nodes[node]);
         ++i;
     }
 
     return neighbors;
 }
 
+/**
+ * @brief Copy the neighbors of a vertex into a caller-provided buffer
+ * 
+ * @param vertex The vertex whose neighbors to retrieve (0-based index)
+ * @param out Buffer with room for at least getDegree(vertex) entries
+ * @return The number of neighbors written
+ * @throws GraphException if vertex index is invalid
+ */
+int Graph::copyNeighbors(int vertex, Neighbor* out) const {
+    checkVertex(vertex);
+    int i = 0;
+    for (int node = adjacencyList[vertex]; node != NO_NODE; node = nodes[node].next) {
+        out[i].vertex = nodes[node].vertex;
+        out[i].weight = nodeWeight(&nodes[node]);
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * @brief Get the largest degree of any vertex
+ * 
+ * @return The maximum of the maintained degree counters
+ */
+int Graph::getMaxDegree() const {
+    int maxDegree = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        if (degree[v] > maxDegree) maxDegree = degree[v];
+    }
+    return maxDegree;
+}
+
 } // namespace graph
@@ -0,0 +1,158 @@
+/** @author meirshuker159@gmail.com */
+
+
+#ifndef GRAPH_INTERNAL_H
+#define GRAPH_INTERNAL_H
+
+#include "Graph.h"
+#include "GraphException.h"
+
+namespace graph {
+
+/*
+ * Helpers shared by the algorithm modules. This header is internal to the
+ * library sources and is not part of the public Include/ interface.
+ */
+
+template<typename T, typename Less>
+static void heapSiftDown(T* items, int i, int count, const Less& less) {
+    while (true) {
+        int largest = i;
+        int left = 2 * i + 1;
+        int right = 2 * i + 2;
+        if (left < count && less(items[largest], items[left])) largest = left;
+        if (right < count && less(items[largest], items[right])) largest = right;
+        if (largest == i) return;
+        swap(items[i], items[largest]);
+        i = largest;
+    }
+}
+
+/**
+ * @brief In-place heap sort by a strict weak order
+ *
+ * Used instead of std::sort; O(count log count) time, O(1) extra space and
+ * no recursion. Not stable, so comparators that need a deterministic order
+ * for equal keys break ties themselves (e.g. by ID).
+ *
+ * @param items Array to sort in ascending order of 'less'
+ * @param count Number of items
+ * @param less Function object, less(a, b) true if a must precede b
+ */
+template<typename T, typename Less>
+static void heapSort(T* items, int count, const Less& less) {
+    for (int i = count / 2 - 1; i >= 0; --i) {
+        heapSiftDown(items, i, count, less);
+    }
+    for (int end = count - 1; end > 0; --end) {
+        swap(items[0], items[end]);
+        heapSiftDown(items, 0, end, less);
+    }
+}
+
+struct IntLess {
+    bool operator()(int a, int b) const { return a < b; }
+};
+
+/**
+ * @brief Sort integers in ascending order
+ */
+static inline void sortInts(int* items, int count) {
+    heapSort(items, count, IntLess());
+}
+
+/**
+ * @brief Read-only CSR snapshot of the adjacency of a graph
+ *
+ * The entries of v are targets[offsets[v] .. offsets[v+1]) in the order
+ * copyNeighbors() returns them, with the matching weights when requested
+ * (weights is null otherwise). Self-loops are dropped on request, and
+ * negative is set if any entry, dropped self-loops included, has a negative
+ * weight. maxDegree is the largest number of entries kept for one vertex.
+ *
+ * Works on any graph type exposing getVertexCount/getDegree/getMaxDegree/
+ * copyNeighbors. The lists are copied in parallel under OpenMP, then
+ * compacted sequentially if self-loops are dropped. Offsets are int, so the
+ * graph must have fewer than 2^31 adjacency entries.
+ */
+struct CsrSnapshot {
+    int n;
+    int maxDegree;
+    bool negative;
+    int* offsets;
+    int* targets;
+    Weight* weights;
+
+    template<typename G>
+    CsrSnapshot(const G& g, bool withWeights, bool dropLoops);
+    ~CsrSnapshot() {
+        delete[] offsets;
+        delete[] targets;
+        delete[] weights;
+    }
+    CsrSnapshot(const CsrSnapshot&) = delete;
+    CsrSnapshot& operator=(const CsrSnapshot&) = delete;
+
+    int degree(int v) const { return offsets[v + 1] - offsets[v]; }
+};
+
+template<typename G>
+CsrSnapshot::CsrSnapshot(const G& g, bool withWeights, bool dropLoops)
+    : n(g.getVertexCount()), maxDegree(0), negative(false), offsets(new int[n + 1]),
+      targets(nullptr), weights(nullptr) {
+    offsets[0] = 0;
+    for (int v = 0; v < n; ++v) {
+        offsets[v + 1] = offsets[v] + g.getDegree(v);
+    }
+    int entries = offsets[n];
+    targets = new int[entries > 0 ? entries : 1];
+    if (withWeights) weights = new Weight[entries > 0 ? entries : 1];
+    int rawMaxDegree = g.getMaxDegree();
+    bool anyNegative = false;
+#ifdef _OPENMP
+#pragma omp parallel reduction(||: anyNegative)
+#endif
+    {
+        Neighbor* neighbors = new Neighbor[rawMaxDegree + 1];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int v = 0; v < n; ++v) {
+            int count = g.copyNeighbors(v, neighbors);
+            int* out = targets + offsets[v];
+            for (int i = 0; i < count; ++i) {
+                out[i] = neighbors[i].vertex;
+                if (isNegative(neighbors[i].weight)) anyNegative = true;
+            }
+            if (weights) {
+                Weight* outWeights = weights + offsets[v];
+                for (int i = 0; i < count; ++i) outWeights[i] = neighbors[i].weight;
+            }
+        }
+        delete[] neighbors;
+    }
+    negative = anyNegative;
+    if (!dropLoops) {
+        maxDegree = rawMaxDegree;
+        return;
+    }
+
+    // Compact in place: entry j only ever moves to a position <= j
+    int size = 0;
+    for (int v = 0; v < n; ++v) {
+        int begin = offsets[v], end = offsets[v + 1];
+        offsets[v] = size;
+        for (int j = begin; j < end; ++j) {
+            if (targets[j] == v) continue;
+            targets[size] = targets[j];
+            if (weights) weights[size] = weights[j];
+            size++;
+        }
+        if (size - offsets[v] > maxDegree) maxDegree = size - offsets[v];
+    }
+    offsets[n] = size;
+}
+
+} // namespace graph
+
+#endif
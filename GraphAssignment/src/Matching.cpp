@@ -0,0 +1,335 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Matching.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+#include "data_structures/Queue.h"
+#include "data_structures/PriorityQueue.h"
+
+namespace graph {
+
+/**
+ * @brief CSR snapshot of a graph together with a bipartition
+ *
+ * @details The neighbors of u are targets[offsets[u] .. offsets[u+1]), and
+ * side[u] is true on the second side. The sides come from a BFS 2-coloring
+ * over the snapshot; if an edge joins two vertices of the same color,
+ * bipartite is false and side is meaningless.
+ */
+struct SideAdjacency : CsrSnapshot {
+    bool bipartite;
+    bool* side;
+
+    explicit SideAdjacency(const Graph& g);
+    ~SideAdjacency() {
+        delete[] side;
+    }
+    SideAdjacency(const SideAdjacency&) = delete;
+    SideAdjacency& operator=(const SideAdjacency&) = delete;
+
+private:
+    bool colorSides();
+};
+
+SideAdjacency::SideAdjacency(const Graph& g)
+    : CsrSnapshot(g, true, false), bipartite(false), side(new bool[n > 0 ? n : 1]) {
+    bipartite = colorSides();
+}
+
+// BFS 2-coloring from the smallest vertex of every component
+bool SideAdjacency::colorSides() {
+    bool* seen = new bool[n > 0 ? n : 1]();
+    Queue queue(n > 0 ? n : 1);
+    bool valid = true;
+    for (int root = 0; root < n && valid; ++root) {
+        if (seen[root]) continue;
+        seen[root] = true;
+        side[root] = false;
+        queue.enqueue(root);
+        while (!queue.isEmpty()) {
+            int u = queue.dequeue();
+            for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+                int v = targets[j];
+                if (!seen[v]) {
+                    seen[v] = true;
+                    side[v] = !side[u];
+                    queue.enqueue(v);
+                } else if (side[v] == side[u]) {
+                    valid = false;
+                }
+            }
+        }
+    }
+    delete[] seen;
+    return valid;
+}
+
+bool Matching::isBipartite(const Graph& g) {
+    SideAdjacency a(g);
+    return a.bipartite;
+}
+
+bool* Matching::bipartition(const Graph& g) {
+    SideAdjacency a(g);
+    if (!a.bipartite)
+        throw GraphException("Graph is not bipartite");
+    bool* side = new bool[a.n > 0 ? a.n : 1];
+    for (int v = 0; v < a.n; ++v) side[v] = a.side[v];
+    return side;
+}
+
+/**
+ * @brief Karp-Sipser initial matching
+ *
+ * @details degree[v] counts the edges of v to unmatched vertices. A vertex
+ * with one such edge can always be matched along it without losing
+ * optimality, so those are matched first; when none is left, the lowest
+ * unmatched vertex with an edge is matched arbitrarily. On sparse graphs
+ * this leaves few augmenting paths for the Hopcroft-Karp phases.
+ */
+static int karpSipser(const SideAdjacency& a, int* mate) {
+    int n = a.n;
+    int* degree = new int[n > 0 ? n : 1];
+    int* pending = new int[n > 0 ? n : 1];
+    int top = 0;
+    for (int v = 0; v < n; ++v) {
+        mate[v] = -1;
+        degree[v] = a.offsets[v + 1] - a.offsets[v];
+        if (degree[v] == 1) pending[top++] = v;
+    }
+
+    int size = 0;
+    int scan = 0;
+    while (true) {
+        int v;
+        if (top > 0) {
+            v = pending[--top];
+        } else {
+            while (scan < n && (mate[scan] != -1 || degree[scan] == 0)) scan++;
+            if (scan == n) break;
+            v = scan;
+        }
+        if (mate[v] != -1 || degree[v] == 0) continue;
+        int u = -1;
+        for (int j = a.offsets[v]; j < a.offsets[v + 1] && u == -1; ++j) {
+            if (mate[a.targets[j]] == -1) u = a.targets[j];
+        }
+        mate[v] = u;
+        mate[u] = v;
+        size++;
+        for (int j = a.offsets[u]; j < a.offsets[u + 1]; ++j) {
+            int x = a.targets[j];
+            if (mate[x] == -1 && --degree[x] == 1) pending[top++] = x;
+        }
+        for (int j = a.offsets[v]; j < a.offsets[v + 1]; ++j) {
+            int x = a.targets[j];
+            if (mate[x] == -1 && --degree[x] == 1) pending[top++] = x;
+        }
+    }
+    delete[] degree;
+    delete[] pending;
+    return size;
+}
+
+/**
+ * @brief Hopcroft-Karp phases
+ *
+ * @details dist[u] is the BFS layer of a first-side vertex u in the
+ * alternating graph, and limit the layer at which the first free
+ * second-side vertex is adjacent. The DFS keeps the path on an explicit
+ * stack; next[u] is the arc u is trying, and is only advanced once the
+ * vertex behind it failed, so the stack holds the chosen arcs when a free
+ * vertex is reached. A vertex whose arcs are exhausted is taken out of the
+ * layering for the rest of the phase.
+ */
+int* Matching::maximumMatching(const Graph& g, int& size) {
+    SideAdjacency a(g);
+    if (!a.bipartite)
+        throw GraphException("Graph is not bipartite");
+    int n = a.n;
+    const int unreached = n + 1;
+    int* mate = new int[n > 0 ? n : 1];
+    int* dist = new int[n > 0 ? n : 1];
+    int* next = new int[n > 0 ? n : 1];
+    int* stack = new int[n > 0 ? n : 1];
+    size = karpSipser(a, mate);
+
+    Queue queue(n > 0 ? n : 1);
+    while (true) {
+        int limit = unreached;
+        for (int u = 0; u < n; ++u) {
+            if (!a.side[u] && mate[u] == -1) {
+                dist[u] = 0;
+                queue.enqueue(u);
+            } else {
+                dist[u] = unreached;
+            }
+        }
+        while (!queue.isEmpty()) {
+            int u = queue.dequeue();
+            if (dist[u] > limit) continue;
+            for (int j = a.offsets[u]; j < a.offsets[u + 1]; ++j) {
+                int w = mate[a.targets[j]];
+                if (w == -1) {
+                    if (limit == unreached) limit = dist[u];
+                } else if (dist[w] == unreached) {
+                    dist[w] = dist[u] + 1;
+                    queue.enqueue(w);
+                }
+            }
+        }
+        if (limit == unreached) break;
+
+        for (int u = 0; u < n; ++u) next[u] = a.offsets[u];
+        for (int root = 0; root < n; ++root) {
+            if (a.side[root] || mate[root] != -1) continue;
+            int top = 0;
+            stack[top++] = root;
+            while (top > 0) {
+                int u = stack[top - 1];
+                if (next[u] == a.offsets[u + 1]) {
+                    dist[u] = unreached;
+                    if (--top > 0) next[stack[top - 1]]++;
+                    continue;
+                }
+                int w = mate[a.targets[next[u]]];
+                if (w == -1 && dist[u] == limit) {
+                    for (int i = 0; i < top; ++i) {
+                        int x = stack[i];
+                        int y = a.targets[next[x]];
+                        mate[x] = y;
+                        mate[y] = x;
+                    }
+                    size++;
+                    break;
+                }
+                if (w != -1 && dist[w] == dist[u] + 1 && dist[w] <= limit) {
+                    stack[top++] = w;
+                } else {
+                    next[u]++;
+                }
+            }
+        }
+    }
+
+    delete[] dist;
+    delete[] next;
+    delete[] stack;
+    return mate;
+}
+
+/**
+ * @brief Successive shortest augmenting paths with potentials
+ *
+ * @details An unmatched edge (u, v) is traversed from the first side to the
+ * second with reduced weight w + pot[u] - pot[v] >= 0; a matched edge is
+ * traversed back with reduced weight 0, so a matched vertex v passes its
+ * distance on to mate[v] unchanged. Each round runs Dijkstra from all free
+ * first-side vertices until the nearest free second-side vertex t is
+ * settled, augments along the path to t, and adds min(dist, dist[t]) to
+ * every potential, which keeps all reduced weights non-negative and makes
+ * the new matched edges tight. Free first-side vertices always get 0 and
+ * free second-side vertices dist[t], so the free vertices of each side
+ * keep one common potential and the nearest t in reduced weight is also
+ * the nearest in real weight. Initially the second side has the smallest
+ * edge weight as potential and the first side 0.
+ */
+int* Matching::minWeightAssignment(const Graph& g, int& size, Distance& weight) {
+    SideAdjacency a(g);
+    if (!a.bipartite)
+        throw GraphException("Graph is not bipartite");
+    int n = a.n;
+    int* mate = new int[n > 0 ? n : 1];
+    Distance* pot = new Distance[n > 0 ? n : 1];
+    Distance* dist = new Distance[n > 0 ? n : 1];
+    bool* reached = new bool[n > 0 ? n : 1];
+    bool* settled = new bool[n > 0 ? n : 1];
+    int* from = new int[n > 0 ? n : 1];
+    Weight* fromWeight = new Weight[n > 0 ? n : 1];
+    Weight* mateWeight = new Weight[n > 0 ? n : 1];
+    Distance lightest = 0;
+    for (int j = 0; j < a.offsets[n]; ++j) {
+        if (j == 0 || a.weights[j] < lightest) lightest = a.weights[j];
+    }
+    for (int v = 0; v < n; ++v) {
+        mate[v] = -1;
+        pot[v] = a.side[v] ? lightest : 0;
+    }
+
+    size = 0;
+    while (true) {
+        PriorityQueue pq(a.offsets[n] + n + 1);
+        for (int v = 0; v < n; ++v) {
+            reached[v] = settled[v] = false;
+            if (!a.side[v] && mate[v] == -1) {
+                reached[v] = true;
+                dist[v] = 0;
+                pq.insert(v, 0);
+            }
+        }
+
+        int target = -1;
+        while (!pq.isEmpty()) {
+            int x = pq.extractMin();
+            if (settled[x]) continue;
+            settled[x] = true;
+            if (a.side[x]) {
+                if (mate[x] == -1) {
+                    target = x;
+                    break;
+                }
+                int u = mate[x];
+                if (!reached[u] || dist[x] < dist[u]) {
+                    reached[u] = true;
+                    dist[u] = dist[x];
+                    pq.insert(u, dist[u]);
+                }
+                continue;
+            }
+            for (int j = a.offsets[x]; j < a.offsets[x + 1]; ++j) {
+                int v = a.targets[j];
+                if (v == mate[x] || settled[v]) continue;
+                Distance d = dist[x] + a.weights[j] + pot[x] - pot[v];
+                if (!reached[v] || d < dist[v]) {
+                    reached[v] = true;
+                    dist[v] = d;
+                    from[v] = x;
+                    fromWeight[v] = a.weights[j];
+                    pq.insert(v, d);
+                }
+            }
+        }
+        if (target == -1) break;
+
+        Distance limit = dist[target];
+        for (int v = 0; v < n; ++v) {
+            pot[v] += (reached[v] && dist[v] < limit) ? dist[v] : limit;
+        }
+        for (int v = target; v != -1; ) {
+            int u = from[v];
+            int previous = mate[u];
+            mate[u] = v;
+            mate[v] = u;
+            mateWeight[u] = fromWeight[v];
+            v = previous;
+        }
+        size++;
+    }
+
+    weight = 0;
+    for (int u = 0; u < n; ++u) {
+        if (!a.side[u] && mate[u] != -1) weight += mateWeight[u];
+    }
+    delete[] pot;
+    delete[] dist;
+    delete[] reached;
+    delete[] settled;
+    delete[] from;
+    delete[] fromWeight;
+    delete[] mateWeight;
+    return mate;
+}
+
+} // namespace graph
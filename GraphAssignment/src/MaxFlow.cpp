@@ -0,0 +1,346 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "MaxFlow.h"
+#include "Graph.h"
+#include "DirectedGraph.h"
+#include "GraphException.h"
+#include "data_structures/Queue.h"
+
+namespace graph {
+
+/**
+ * @brief Residual network and highest-label push-relabel state
+ *
+ * @details The arcs leaving v are first[v] .. first[v+1]); arc a goes to
+ * head[a], has residual capacity residual[a], and reverse[a] is the
+ * opposite arc of the same edge, so pushing along a returns capacity to
+ * reverse[a].
+ *
+ * Vertices with label < n are kept in one doubly-linked list per label
+ * (bucketHead / bucketNext / bucketPrev) for the gap heuristic; vertices
+ * with excess are also on a stack per label (activeHead / activeNext), and
+ * the highest non-empty stack is discharged next. Label n marks vertices
+ * that cannot reach the sink any more; they are left alone.
+ */
+struct FlowNetwork {
+    int n;
+    int source;
+    int sink;
+    int* first;
+    int* head;
+    int* reverse;
+    Distance* residual;
+
+    int* label;
+    Distance* excess;
+    int* current;
+    int* activeHead;
+    int* activeNext;
+    int* bucketHead;
+    int* bucketNext;
+    int* bucketPrev;
+    int maxActive;
+    int maxLabel;
+    long long work;
+
+    template <typename G>
+    FlowNetwork(const G& g, int s, int t, bool undirected);
+    ~FlowNetwork();
+    FlowNetwork(const FlowNetwork&) = delete;
+    FlowNetwork& operator=(const FlowNetwork&) = delete;
+
+    Distance run();
+    bool* sourceSide() const;
+
+private:
+    void reachSink(int* distance, bool skipSource) const;
+    void globalRelabel();
+    void activate(int v);
+    void addToBucket(int v);
+    void removeFromBucket(int v);
+    void gap(int d);
+    void relabel(int v);
+    void discharge(int v);
+};
+
+// Arcs of the edge list: each undirected edge once (from its smaller
+// endpoint) with capacity both ways, each directed edge with capacity one way
+template <typename G>
+static int countArcPairs(const G& g, bool undirected, Neighbor* neighbors) {
+    int pairs = 0;
+    bool negative = false;
+    for (int u = 0; u < g.getVertexCount(); ++u) {
+        int count = g.copyNeighbors(u, neighbors);
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            if (isNegative(neighbors[i].weight)) negative = true;
+            if (u != v && (!undirected || u < v)) pairs++;
+        }
+    }
+    if (negative) {
+        delete[] neighbors;
+        throw GraphException("Edge weights must not be negative");
+    }
+    return pairs;
+}
+
+template <typename G>
+FlowNetwork::FlowNetwork(const G& g, int s, int t, bool undirected)
+    : n(g.getVertexCount()), source(s), sink(t), maxActive(-1), maxLabel(-1), work(0) {
+    if (s < 0 || s >= n || t < 0 || t >= n)
+        throw GraphException("Vertex index out of bounds");
+    if (s == t)
+        throw GraphException("Source and sink must differ");
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    int arcs = 2 * countArcPairs(g, undirected, neighbors);
+
+    first = new int[n + 1]();
+    head = new int[arcs > 0 ? arcs : 1];
+    reverse = new int[arcs > 0 ? arcs : 1];
+    residual = new Distance[arcs > 0 ? arcs : 1];
+    for (int u = 0; u < n; ++u) {
+        int count = g.copyNeighbors(u, neighbors);
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            if (u != v && (!undirected || u < v)) {
+                first[u + 1]++;
+                first[v + 1]++;
+            }
+        }
+    }
+    for (int v = 0; v < n; ++v) first[v + 1] += first[v];
+    int* fill = new int[n];
+    for (int v = 0; v < n; ++v) fill[v] = first[v];
+    for (int u = 0; u < n; ++u) {
+        int count = g.copyNeighbors(u, neighbors);
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            if (u == v || (undirected && u > v)) continue;
+            int forward = fill[u]++, backward = fill[v]++;
+            head[forward] = v;
+            head[backward] = u;
+            reverse[forward] = backward;
+            reverse[backward] = forward;
+            residual[forward] = neighbors[i].weight;
+            residual[backward] = undirected ? neighbors[i].weight : 0;
+        }
+    }
+    delete[] fill;
+    delete[] neighbors;
+
+    label = new int[n];
+    excess = new Distance[n]();
+    current = new int[n];
+    activeHead = new int[n + 1];
+    activeNext = new int[n];
+    bucketHead = new int[n + 1];
+    bucketNext = new int[n];
+    bucketPrev = new int[n];
+}
+
+FlowNetwork::~FlowNetwork() {
+    delete[] first;
+    delete[] head;
+    delete[] reverse;
+    delete[] residual;
+    delete[] label;
+    delete[] excess;
+    delete[] current;
+    delete[] activeHead;
+    delete[] activeNext;
+    delete[] bucketHead;
+    delete[] bucketNext;
+    delete[] bucketPrev;
+}
+
+// Backward BFS from the sink over arcs with residual capacity: distance[v]
+// is the number of arcs from v to the sink, n if it cannot reach it
+void FlowNetwork::reachSink(int* distance, bool skipSource) const {
+    for (int v = 0; v < n; ++v) distance[v] = n;
+    distance[sink] = 0;
+    Queue queue(n);
+    queue.enqueue(sink);
+    while (!queue.isEmpty()) {
+        int x = queue.dequeue();
+        for (int a = first[x]; a < first[x + 1]; ++a) {
+            int u = head[a];
+            if (distance[u] == n && residual[reverse[a]] > 0 && !(skipSource && u == source)) {
+                distance[u] = distance[x] + 1;
+                queue.enqueue(u);
+            }
+        }
+    }
+}
+
+// Exact labels from a BFS, then all lists and stacks rebuilt
+void FlowNetwork::globalRelabel() {
+    reachSink(label, true);
+    label[source] = n;
+    for (int d = 0; d <= n; ++d) {
+        activeHead[d] = -1;
+        bucketHead[d] = -1;
+    }
+    maxActive = maxLabel = -1;
+    for (int v = 0; v < n; ++v) {
+        current[v] = first[v];
+        if (label[v] >= n) continue;
+        addToBucket(v);
+        if (excess[v] > 0 && v != sink) activate(v);
+    }
+    work = 0;
+}
+
+void FlowNetwork::activate(int v) {
+    activeNext[v] = activeHead[label[v]];
+    activeHead[label[v]] = v;
+    if (label[v] > maxActive) maxActive = label[v];
+}
+
+void FlowNetwork::addToBucket(int v) {
+    int d = label[v];
+    bucketPrev[v] = -1;
+    bucketNext[v] = bucketHead[d];
+    if (bucketHead[d] != -1) bucketPrev[bucketHead[d]] = v;
+    bucketHead[d] = v;
+    if (d > maxLabel) maxLabel = d;
+}
+
+void FlowNetwork::removeFromBucket(int v) {
+    if (bucketPrev[v] != -1) {
+        bucketNext[bucketPrev[v]] = bucketNext[v];
+    } else {
+        bucketHead[label[v]] = bucketNext[v];
+    }
+    if (bucketNext[v] != -1) bucketPrev[bucketNext[v]] = bucketPrev[v];
+}
+
+// No vertex is left at label d, so nothing above d can reach the sink
+void FlowNetwork::gap(int d) {
+    for (int l = d + 1; l <= maxLabel; ++l) {
+        for (int x = bucketHead[l]; x != -1; x = bucketNext[x]) label[x] = n;
+        bucketHead[l] = -1;
+        activeHead[l] = -1;
+    }
+    maxLabel = d - 1;
+    if (maxActive > d - 1) maxActive = d - 1;
+}
+
+void FlowNetwork::relabel(int v) {
+    int old = label[v];
+    work += 12 + first[v + 1] - first[v];
+    removeFromBucket(v);
+    if (bucketHead[old] == -1) {
+        gap(old);
+        label[v] = n;
+        return;
+    }
+    int lowest = n;
+    for (int a = first[v]; a < first[v + 1]; ++a) {
+        if (residual[a] > 0 && label[head[a]] + 1 < lowest) {
+            lowest = label[head[a]] + 1;
+            current[v] = a;
+        }
+    }
+    label[v] = lowest;
+    if (lowest < n) addToBucket(v);
+}
+
+// Push along admissible arcs (label drops by one) until the excess is gone,
+// relabeling whenever the current arc runs off the end of the list
+void FlowNetwork::discharge(int v) {
+    while (excess[v] > 0) {
+        int d = label[v];
+        int a = current[v];
+        for (; a < first[v + 1]; ++a) {
+            int w = head[a];
+            if (residual[a] <= 0 || label[w] != d - 1) continue;
+            Distance delta = excess[v] < residual[a] ? excess[v] : residual[a];
+            residual[a] -= delta;
+            residual[reverse[a]] += delta;
+            if (excess[w] == 0 && w != sink) {
+                excess[w] = delta;
+                activate(w);
+            } else {
+                excess[w] += delta;
+            }
+            excess[v] -= delta;
+            if (excess[v] == 0) break;
+        }
+        if (a < first[v + 1]) {
+            current[v] = a;
+            return;
+        }
+        relabel(v);
+        if (label[v] >= n) return;
+    }
+}
+
+/**
+ * @brief First phase of push-relabel: a maximum preflow
+ *
+ * @details The source arcs are saturated, then the active vertex with the
+ * highest label is discharged until none is left. The excess at the sink
+ * is then the maximum flow value; excess stranded at vertices that cannot
+ * reach the sink would only flow back to the source, which is not needed
+ * for the value or the minimum cut.
+ */
+Distance FlowNetwork::run() {
+    for (int a = first[source]; a < first[source + 1]; ++a) {
+        Distance delta = residual[a];
+        if (delta <= 0) continue;
+        residual[a] = 0;
+        residual[reverse[a]] += delta;
+        excess[head[a]] += delta;
+        excess[source] -= delta;
+    }
+    globalRelabel();
+    long long relabelPeriod = 6LL * n + first[n];
+
+    while (maxActive >= 0) {
+        int v = activeHead[maxActive];
+        if (v == -1) {
+            maxActive--;
+            continue;
+        }
+        activeHead[maxActive] = activeNext[v];
+        discharge(v);
+        if (work > relabelPeriod) globalRelabel();
+    }
+    return excess[sink];
+}
+
+bool* FlowNetwork::sourceSide() const {
+    int* distance = new int[n];
+    reachSink(distance, false);
+    bool* side = new bool[n];
+    for (int v = 0; v < n; ++v) side[v] = distance[v] == n;
+    delete[] distance;
+    return side;
+}
+
+Distance MaxFlow::maxFlow(const Graph& g, int source, int sink) {
+    FlowNetwork network(g, source, sink, true);
+    return network.run();
+}
+
+Distance MaxFlow::maxFlow(const DirectedGraph& g, int source, int sink) {
+    FlowNetwork network(g, source, sink, false);
+    return network.run();
+}
+
+Distance MaxFlow::minCut(const Graph& g, int source, int sink, bool*& sourceSide) {
+    FlowNetwork network(g, source, sink, true);
+    Distance value = network.run();
+    sourceSide = network.sourceSide();
+    return value;
+}
+
+Distance MaxFlow::minCut(const DirectedGraph& g, int source, int sink, bool*& sourceSide) {
+    FlowNetwork network(g, source, sink, false);
+    Distance value = network.run();
+    sourceSide = network.sourceSide();
+    return value;
+}
+
+} // namespace graph
@@ -0,0 +1,429 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "MinCut.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+#include "data_structures/PriorityQueue.h"
+#include "data_structures/UnionFind.h"
+#include <cmath>
+
+namespace graph {
+
+/**
+ * @brief Edge list of the active vertices, renumbered 0..count-1
+ *
+ * @details Every edge is listed once and self-loops are dropped. vertex[i]
+ * is the graph ID of compact vertex i.
+ */
+struct CutInput {
+    int count;
+    int* vertex;
+    Edge* edges;
+    int m;
+
+    explicit CutInput(const Graph& g);
+    ~CutInput() {
+        delete[] vertex;
+        delete[] edges;
+    }
+    CutInput(const CutInput&) = delete;
+    CutInput& operator=(const CutInput&) = delete;
+
+    // Side flags indexed by graph ID, from flags over compact vertices
+    bool* expand(const Graph& g, const bool* compactSide) const;
+};
+
+CutInput::CutInput(const Graph& g) : count(0), vertex(nullptr), edges(nullptr), m(0) {
+    int n = g.getVertexCount();
+    Neighbor* neighbors = new Neighbor[g.getMaxDegree() + 1];
+    int* id = new int[n > 0 ? n : 1];
+    long long halfEdges = 0;
+    bool negative = false;
+    for (int v = 0; v < n; ++v) {
+        id[v] = g.hasVertex(v) ? count++ : -1;
+        int degree = g.copyNeighbors(v, neighbors);
+        halfEdges += degree;
+        for (int i = 0; i < degree; ++i) {
+            if (isNegative(neighbors[i].weight)) negative = true;
+        }
+    }
+    if (count < 2 || negative) {
+        delete[] neighbors;
+        delete[] id;
+        if (negative)
+            throw GraphException("Edge weights must not be negative");
+        throw GraphException("Minimum cut needs at least two vertices");
+    }
+
+    vertex = new int[count];
+    edges = new Edge[halfEdges / 2 + 1];
+    for (int v = 0; v < n; ++v) {
+        if (id[v] == -1) continue;
+        vertex[id[v]] = v;
+        int degree = g.copyNeighbors(v, neighbors);
+        for (int i = 0; i < degree; ++i) {
+            int w = neighbors[i].vertex;
+            if (v < w) {
+                edges[m].src = id[v];
+                edges[m].dest = id[w];
+                edges[m].weight = neighbors[i].weight;
+                m++;
+            }
+        }
+    }
+    delete[] neighbors;
+    delete[] id;
+}
+
+bool* CutInput::expand(const Graph& g, const bool* compactSide) const {
+    int n = g.getVertexCount();
+    bool* side = new bool[n]();
+    for (int i = 0; i < count; ++i) {
+        side[vertex[i]] = compactSide[i];
+    }
+    return side;
+}
+
+/**
+ * @brief Stoer-Wagner phases over merged vertex groups
+ *
+ * @details The original adjacency is kept as CSR; merged vertices are groups
+ * linked through nextMember, and group[x] is the group of vertex x. Scanning
+ * a group scans the edges of all its members, so no merged adjacency is
+ * built. Within a phase, the heap key of a group is its total edge weight to
+ * the groups already added; the key of the last group when it is added is
+ * the value of the cut between it and everything else.
+ */
+Distance MinCut::stoerWagner(const Graph& g, bool*& side) {
+    CutInput input(g);
+    int k = input.count;
+
+    int* offsets = new int[k + 1]();
+    for (int i = 0; i < input.m; ++i) {
+        offsets[input.edges[i].src + 1]++;
+        offsets[input.edges[i].dest + 1]++;
+    }
+    for (int v = 0; v < k; ++v) offsets[v + 1] += offsets[v];
+    int* targets = new int[offsets[k] > 0 ? offsets[k] : 1];
+    Weight* weights = new Weight[offsets[k] > 0 ? offsets[k] : 1];
+    int* fill = new int[k];
+    for (int v = 0; v < k; ++v) fill[v] = offsets[v];
+    for (int i = 0; i < input.m; ++i) {
+        const Edge& e = input.edges[i];
+        targets[fill[e.src]] = e.dest;
+        weights[fill[e.src]++] = e.weight;
+        targets[fill[e.dest]] = e.src;
+        weights[fill[e.dest]++] = e.weight;
+    }
+
+    int* group = new int[k];
+    int* head = new int[k];
+    int* last = new int[k];
+    int* nextMember = new int[k];
+    int* alive = new int[k];
+    bool* bestSide = new bool[k]();
+    for (int v = 0; v < k; ++v) {
+        group[v] = head[v] = last[v] = alive[v] = v;
+        nextMember[v] = -1;
+    }
+
+    Distance best = 0;
+    bool found = false;
+    for (int groups = k; groups > 1; --groups) {
+        PriorityQueue pq(k, true, true);
+        for (int i = 0; i < groups; ++i) pq.insert(alive[i], 0);
+        int s = -1, t = -1;
+        Distance cut = 0;
+        while (!pq.isEmpty()) {
+            cut = pq.topPriority();
+            s = t;
+            t = pq.extractTop();
+            for (int x = head[t]; x != -1; x = nextMember[x]) {
+                for (int j = offsets[x]; j < offsets[x + 1]; ++j) {
+                    int w = group[targets[j]];
+                    if (pq.contains(w)) pq.changePriority(w, pq.priorityOf(w) + weights[j]);
+                }
+            }
+        }
+
+        if (!found || cut < best) {
+            found = true;
+            best = cut;
+            for (int v = 0; v < k; ++v) bestSide[v] = false;
+            for (int x = head[t]; x != -1; x = nextMember[x]) bestSide[x] = true;
+        }
+
+        // Merge t into s
+        for (int x = head[t]; x != -1; x = nextMember[x]) group[x] = s;
+        nextMember[last[s]] = head[t];
+        last[s] = last[t];
+        for (int i = 0; i < groups; ++i) {
+            if (alive[i] == t) {
+                alive[i] = alive[groups - 1];
+                break;
+            }
+        }
+    }
+
+    side = input.expand(g, bestSide);
+    delete[] offsets;
+    delete[] targets;
+    delete[] weights;
+    delete[] fill;
+    delete[] group;
+    delete[] head;
+    delete[] last;
+    delete[] nextMember;
+    delete[] alive;
+    delete[] bestSide;
+    return best;
+}
+
+static unsigned int nextRandom(unsigned int& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Orders edge indices by ascending key
+struct EdgeKeyLess {
+    const double* key;
+    bool operator()(int a, int b) const { return key[a] < key[b]; }
+};
+
+/**
+ * @brief One level of contraction: map[v] is the vertex that v of the parent
+ * level became. Levels are chained up to the compact input vertices.
+ */
+struct ContractionLevel {
+    const int* map;
+    const ContractionLevel* parent;
+
+    int resolve(int v) const { return map[parent ? parent->resolve(v) : v]; }
+};
+
+/**
+ * @brief State of one Karger-Stein trial: the best cut found so far and
+ * its side flags over the compact input vertices
+ */
+struct KargerTrial {
+    int inputCount;
+    unsigned int state;
+    bool found;
+    Distance best;
+    bool* side;
+};
+
+// Edge of a contracted graph; parallel edges are merged, so weights are sums
+struct CutEdge {
+    int u;
+    int v;
+    Distance weight;
+};
+
+/**
+ * @brief Contract random edges until 'target' vertices remain
+ *
+ * @details Contracting edges in increasing order of independent exponential
+ * keys with rates equal to the weights picks every next edge with
+ * probability proportional to its weight among the remaining ones, like
+ * Kruskal's algorithm on random keys. Edges inside a merged vertex are
+ * dropped and parallel edges merged, so the result has at most
+ * target * (target - 1) / 2 edges.
+ */
+static CutEdge* contractTo(const CutEdge* edges, int m, int n, int target, unsigned int& state,
+                           int* map, int& newM) {
+    double* key = new double[m > 0 ? m : 1];
+    int* order = new int[m > 0 ? m : 1];
+    for (int i = 0; i < m; ++i) {
+        double u = ((nextRandom(state) >> 8) + 1.0) / 16777216.0;  // (0, 1]
+        key[i] = edges[i].weight > 0 ? -std::log(u) / (double)edges[i].weight : HUGE_VAL;
+        order[i] = i;
+    }
+    heapSort(order, m, EdgeKeyLess{key});
+
+    UnionFind uf(n);
+    int remaining = n;
+    for (int i = 0; i < m && remaining > target; ++i) {
+        const CutEdge& e = edges[order[i]];
+        if (uf.find(e.u) != uf.find(e.v)) {
+            uf.unite(e.u, e.v);
+            remaining--;
+        }
+    }
+
+    int* label = new int[n];
+    for (int v = 0; v < n; ++v) label[v] = -1;
+    int next = 0;
+    for (int v = 0; v < n; ++v) {
+        int root = uf.find(v);
+        if (label[root] == -1) label[root] = next++;
+        map[v] = label[root];
+    }
+
+    // Bucket the surviving edges by smaller endpoint, then merge parallel
+    // ones: slot[b] is where the edge (a, b) of the current bucket went
+    int* start = new int[target + 1]();
+    for (int i = 0; i < m; ++i) {
+        int a = map[edges[i].u], b = map[edges[i].v];
+        if (a != b) start[(a < b ? a : b) + 1]++;
+    }
+    for (int a = 0; a < target; ++a) start[a + 1] += start[a];
+    int* bucket = new int[start[target] > 0 ? start[target] : 1];
+    for (int i = 0; i < m; ++i) {
+        int a = map[edges[i].u], b = map[edges[i].v];
+        if (a != b) bucket[start[a < b ? a : b]++] = i;
+    }
+    for (int a = target; a > 0; --a) start[a] = start[a - 1];
+    start[0] = 0;
+
+    CutEdge* result = new CutEdge[start[target] > 0 ? start[target] : 1];
+    int* slot = new int[target];
+    for (int b = 0; b < target; ++b) slot[b] = -1;
+    newM = 0;
+    for (int a = 0; a < target; ++a) {
+        int first = newM;
+        for (int j = start[a]; j < start[a + 1]; ++j) {
+            const CutEdge& e = edges[bucket[j]];
+            int b = map[e.u] == a ? map[e.v] : map[e.u];
+            if (slot[b] >= first) {
+                result[slot[b]].weight += e.weight;
+            } else {
+                slot[b] = newM;
+                result[newM].u = a;
+                result[newM].v = b;
+                result[newM].weight = e.weight;
+                newM++;
+            }
+        }
+    }
+    delete[] key;
+    delete[] order;
+    delete[] label;
+    delete[] start;
+    delete[] bucket;
+    delete[] slot;
+    return result;
+}
+
+static void recursiveContract(const CutEdge* edges, int m, int n, const ContractionLevel* level,
+                              KargerTrial& trial) {
+    if (n <= 6) {
+        // Vertex n - 1 stays on side 0; every other split is tried
+        Distance bestCut = 0;
+        int bestMask = -1;
+        for (int mask = 1; mask < (1 << (n - 1)); ++mask) {
+            Distance cut = 0;
+            for (int i = 0; i < m; ++i) {
+                if (((mask >> edges[i].u) ^ (mask >> edges[i].v)) & 1) cut += edges[i].weight;
+            }
+            if (bestMask == -1 || cut < bestCut) {
+                bestCut = cut;
+                bestMask = mask;
+            }
+        }
+        if (!trial.found || bestCut < trial.best) {
+            trial.found = true;
+            trial.best = bestCut;
+            for (int v = 0; v < trial.inputCount; ++v) {
+                int leaf = level ? level->resolve(v) : v;
+                trial.side[v] = ((bestMask >> leaf) & 1) != 0;
+            }
+        }
+        return;
+    }
+
+    int target = (int)std::ceil(1 + n / std::sqrt(2.0));
+    if (target >= n) target = n - 1;
+    int* map = new int[n];
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        int newM = 0;
+        CutEdge* contracted = contractTo(edges, m, n, target, trial.state, map, newM);
+        ContractionLevel next = {map, level};
+        recursiveContract(contracted, newM, target, &next, trial);
+        delete[] contracted;
+    }
+    delete[] map;
+}
+
+/**
+ * @brief Independent Karger-Stein trials, best cut wins
+ *
+ * @details A disconnected graph has a cut of value 0, which contraction
+ * cannot find without first merging components, so that case is answered
+ * directly with the component of vertex 0. Every trial has its own
+ * generator state and side buffer; among equal values the lowest trial
+ * index wins, so the result does not depend on the thread count.
+ */
+Distance MinCut::kargerStein(const Graph& g, bool*& side, int trials, unsigned int seed) {
+    if (trials < 0)
+        throw GraphException("Trial count must not be negative");
+    CutInput input(g);
+    int k = input.count;
+    bool* bestSide = new bool[k];
+
+    UnionFind components(k);
+    for (int i = 0; i < input.m; ++i) components.unite(input.edges[i].src, input.edges[i].dest);
+    int first = components.find(0);
+    bool connected = true;
+    for (int v = 0; v < k; ++v) {
+        bestSide[v] = components.find(v) == first;
+        if (!bestSide[v]) connected = false;
+    }
+    if (!connected) {
+        side = input.expand(g, bestSide);
+        delete[] bestSide;
+        return 0;
+    }
+
+    CutEdge* edges = new CutEdge[input.m > 0 ? input.m : 1];
+    for (int i = 0; i < input.m; ++i) {
+        edges[i].u = input.edges[i].src;
+        edges[i].v = input.edges[i].dest;
+        edges[i].weight = input.edges[i].weight;
+    }
+    if (trials == 0) {
+        double lnV = std::log((double)k);
+        trials = (int)std::ceil(lnV * lnV);
+        if (trials < 1) trials = 1;
+    }
+
+    Distance best = 0;
+    int bestTrial = -1;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        bool* trialSide = new bool[k];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for (int t = 0; t < trials; ++t) {
+            KargerTrial trial = {k, (seed ? seed : 1) * 2654435761u + 2 * (unsigned int)t + 1,
+                                 false, 0, trialSide};
+            if (trial.state == 0) trial.state = 1;
+            recursiveContract(edges, input.m, k, nullptr, trial);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            {
+                if (bestTrial == -1 || trial.best < best || (trial.best == best && t < bestTrial)) {
+                    best = trial.best;
+                    bestTrial = t;
+                    for (int v = 0; v < k; ++v) bestSide[v] = trialSide[v];
+                }
+            }
+        }
+        delete[] trialSide;
+    }
+
+    side = input.expand(g, bestSide);
+    delete[] edges;
+    delete[] bestSide;
+    return best;
+}
+
+} // namespace graph
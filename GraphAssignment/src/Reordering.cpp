@@ -0,0 +1,253 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Reordering.h"
+#include "Graph.h"
+#include "data_structures/Queue.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+
+namespace graph {
+
+// Orders vertex IDs by ascending key, ties broken by ID, used to order the
+// neighbors of a vertex by degree
+struct KeyThenIdLess {
+    const int* key;
+    bool operator()(int a, int b) const {
+        return key[a] < key[b] || (key[a] == key[b] && a < b);
+    }
+};
+
+// Vertices sorted by degree (stable counting sort), ascending or descending
+static int* verticesByDegree(const Graph& g, const int* deg, bool descending) {
+    int n = g.getVertexCount();
+    int maxDeg = 0;
+    for (int v = 0; v < n; ++v) {
+        if (deg[v] > maxDeg) maxDeg = deg[v];
+    }
+    int* start = new int[maxDeg + 2]();
+    for (int v = 0; v < n; ++v) {
+        int bucket = descending ? maxDeg - deg[v] : deg[v];
+        start[bucket + 1]++;
+    }
+    for (int d = 0; d <= maxDeg; ++d) {
+        start[d + 1] += start[d];
+    }
+    int* sorted = new int[n];
+    for (int v = 0; v < n; ++v) {
+        int bucket = descending ? maxDeg - deg[v] : deg[v];
+        sorted[start[bucket]++] = v;
+    }
+    delete[] start;
+    return sorted;
+}
+
+static int* degreesOf(const Graph& g) {
+    int n = g.getVertexCount();
+    int* deg = new int[n];
+    for (int v = 0; v < n; ++v) {
+        deg[v] = g.getDegree(v);
+    }
+    return deg;
+}
+
+// BFS from root recording levels; returns the number of vertices reached and
+// sets ecc to the deepest level. Level entries are reset to -1 by the caller.
+static int bfsLevels(const Graph& g, int root, int* level, int* order, int& ecc) {
+    int head = 0, tail = 0;
+    level[root] = 0;
+    order[tail++] = root;
+    ecc = 0;
+    while (head < tail) {
+        int u = order[head++];
+        int count;
+        Neighbor* neighbors = g.getNeighbors(u, count);
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            if (level[v] == -1) {
+                level[v] = level[u] + 1;
+                if (level[v] > ecc) ecc = level[v];
+                order[tail++] = v;
+            }
+        }
+        delete[] neighbors;
+    }
+    return tail;
+}
+
+// George-Liu pseudo-peripheral vertex search: repeatedly move to the
+// minimum-degree vertex of the last BFS level while the eccentricity grows.
+static int pseudoPeripheral(const Graph& g, int start, const int* deg, int* level, int* order) {
+    int root = start;
+    int ecc;
+    int reached = bfsLevels(g, root, level, order, ecc);
+    while (true) {
+        int candidate = -1;
+        for (int i = 0; i < reached; ++i) {
+            int v = order[i];
+            if (level[v] == ecc && (candidate == -1 || deg[v] < deg[candidate]))
+                candidate = v;
+        }
+        for (int i = 0; i < reached; ++i) level[order[i]] = -1;
+
+        int candidateEcc;
+        reached = bfsLevels(g, candidate, level, order, candidateEcc);
+        if (candidateEcc <= ecc) {
+            for (int i = 0; i < reached; ++i) level[order[i]] = -1;
+            return root;
+        }
+        root = candidate;
+        ecc = candidateEcc;
+    }
+}
+
+// Reverse Cuthill-McKee: BFS from a pseudo-peripheral vertex per component,
+// neighbors in increasing degree order, final order reversed
+int* Reordering::reverseCuthillMcKee(const Graph& g) {
+    int n = g.getVertexCount();
+    int* deg = degreesOf(g);
+    int* byDegree = verticesByDegree(g, deg, false);
+    int* order = new int[n];
+    int* scratch = new int[n];
+    int* level = new int[n];
+    bool* visited = new bool[n]();
+    for (int v = 0; v < n; ++v) level[v] = -1;
+
+    int pos = 0;
+    for (int s = 0; s < n; ++s) {
+        if (visited[byDegree[s]]) continue;
+        int root = pseudoPeripheral(g, byDegree[s], deg, level, scratch);
+        visited[root] = true;
+        order[pos++] = root;
+        for (int head = pos - 1; head < pos; ++head) {
+            int u = order[head];
+            int count;
+            Neighbor* neighbors = g.getNeighbors(u, count);
+            int added = 0;
+            for (int i = 0; i < count; ++i) {
+                int v = neighbors[i].vertex;
+                if (!visited[v]) {
+                    visited[v] = true;
+                    order[pos + added++] = v;
+                }
+            }
+            delete[] neighbors;
+            heapSort(order + pos, added, KeyThenIdLess{deg});
+            pos += added;
+        }
+    }
+
+    int* perm = new int[n];
+    for (int i = 0; i < n; ++i) {
+        perm[order[i]] = n - 1 - i;
+    }
+    delete[] deg;
+    delete[] byDegree;
+    delete[] order;
+    delete[] scratch;
+    delete[] level;
+    delete[] visited;
+    return perm;
+}
+
+// Degree-descending order via a stable counting sort on degree
+int* Reordering::degreeOrder(const Graph& g) {
+    int n = g.getVertexCount();
+    int* deg = degreesOf(g);
+    int* sorted = verticesByDegree(g, deg, true);
+    int* perm = new int[n];
+    for (int i = 0; i < n; ++i) {
+        perm[sorted[i]] = i;
+    }
+    delete[] deg;
+    delete[] sorted;
+    return perm;
+}
+
+// BFS order: IDs assigned at discovery, components seeded by highest degree
+int* Reordering::bfsOrder(const Graph& g) {
+    int n = g.getVertexCount();
+    int* deg = degreesOf(g);
+    int* seeds = verticesByDegree(g, deg, true);
+    int* perm = new int[n];
+    for (int v = 0; v < n; ++v) perm[v] = -1;
+
+    int next = 0;
+    if (n > 0) {
+        Queue q(n);
+        for (int s = 0; s < n; ++s) {
+            if (perm[seeds[s]] != -1) continue;
+            perm[seeds[s]] = next++;
+            q.enqueue(seeds[s]);
+            while (!q.isEmpty()) {
+                int u = q.dequeue();
+                int count;
+                Neighbor* neighbors = g.getNeighbors(u, count);
+                for (int i = 0; i < count; ++i) {
+                    int v = neighbors[i].vertex;
+                    if (perm[v] == -1) {
+                        perm[v] = next++;
+                        q.enqueue(v);
+                    }
+                }
+                delete[] neighbors;
+            }
+        }
+    }
+    delete[] deg;
+    delete[] seeds;
+    return perm;
+}
+
+// Relabel every edge through perm and bulk-insert into a new graph
+Graph Reordering::apply(const Graph& g, const int* perm) {
+    int n = g.getVertexCount();
+    delete[] inverse(perm, n);  // Validates perm
+
+    long long halfEdges = 0;
+    for (int u = 0; u < n; ++u) {
+        halfEdges += g.getDegree(u);
+    }
+    Edge* edges = new Edge[halfEdges / 2 + 1];
+    int m = 0;
+    for (int u = 0; u < n; ++u) {
+        int count;
+        Neighbor* neighbors = g.getNeighbors(u, count);
+        int loops = 0;
+        for (int i = 0; i < count; ++i) {
+            int v = neighbors[i].vertex;
+            // Each edge is listed at both endpoints; a self-loop twice at u
+            if (u < v || (u == v && ++loops % 2 == 0)) {
+                edges[m].src = perm[u];
+                edges[m].dest = perm[v];
+                edges[m].weight = neighbors[i].weight;
+                m++;
+            }
+        }
+        delete[] neighbors;
+    }
+
+    Graph result(n);
+    result.addEdges(edges, m);
+    delete[] edges;
+    for (int v = 0; v < n; ++v) {
+        if (!g.hasVertex(v)) result.removeVertex(perm[v]);
+    }
+    return result;
+}
+
+// Inverse permutation, checking that every new ID occurs exactly once
+int* Reordering::inverse(const int* perm, int n) {
+    int* inv = new int[n];
+    for (int i = 0; i < n; ++i) inv[i] = -1;
+    for (int v = 0; v < n; ++v) {
+        if (perm[v] < 0 || perm[v] >= n || inv[perm[v]] != -1) {
+            delete[] inv;
+            throw GraphException("Invalid vertex permutation");
+        }
+        inv[perm[v]] = v;
+    }
+    return inv;
+}
+
+} // namespace graph
@@ -0,0 +1,927 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "ShortestPaths.h"
+#include "Graph.h"
+#include "DirectedGraph.h"
+#include "DistanceMatrix.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+#include "data_structures/Queue.h"
+#include "data_structures/PriorityQueue.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace graph {
+
+static const int TILE = 64;
+
+/**
+ * @brief CSR snapshot of the arcs of a graph
+ *
+ * @details The arcs leaving u are targets[offsets[u] .. offsets[u+1]) with
+ * weights parallel to them; an undirected edge appears once from each
+ * end. negative records a negative weight.
+ */
+struct PathArcs : CsrSnapshot {
+    template<typename G>
+    explicit PathArcs(const G& g) : CsrSnapshot(g, true, false) {}
+
+    int bellmanFord(Distance* dist, int* parent) const;
+    int spfa(int source, Distance* dist, int* parent) const;
+    void dijkstra(int source, const Distance* h, Distance* dist, int* parent, PriorityQueue& pq) const;
+};
+
+/**
+ * @brief Bellman-Ford rounds from the current distances
+ *
+ * @details dist holds the starting distances, UNREACHABLE_DISTANCE for vertices
+ * not reached yet; parent, if given, is updated along. Each round relaxes
+ * the arcs of every reached vertex and the rounds stop as soon as one
+ * changes nothing. Paths of at most V - 1 arcs after the start need V - 1
+ * rounds (this also holds when every vertex starts at 0, as from a virtual
+ * source), so a change in round V proves a negative cycle: the last vertex
+ * changed is returned, else -1.
+ */
+int PathArcs::bellmanFord(Distance* dist, int* parent) const {
+    Distance none = UNREACHABLE_DISTANCE;
+    int last = -1;
+    for (int round = 0; round < n; ++round) {
+        last = -1;
+        for (int u = 0; u < n; ++u) {
+            if (dist[u] == none) continue;
+            for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+                int v = targets[j];
+                if (dist[u] + weights[j] < dist[v]) {
+                    dist[v] = dist[u] + weights[j];
+                    if (parent) parent[v] = u;
+                    last = v;
+                }
+            }
+        }
+        if (last == -1) return -1;
+    }
+    return last;
+}
+
+/**
+ * @brief SPFA with the SLF and LLL queue heuristics
+ *
+ * @details dist is UNREACHABLE_DISTANCE everywhere on entry and parent -1. The
+ * queue holds every vertex at most once (queued), so V entries suffice,
+ * and sum is the total distance of the queued vertices, kept up to date
+ * when a queued vertex improves. Some queued vertex is at most the
+ * average, so LLL rotates fewer than size() times; the bound on the
+ * rotations only guards against rounding with floating distances.
+ * hops[v] counts the arcs of the path behind dist[v]: without negative
+ * cycles it stays below V, so reaching V returns that vertex; otherwise -1
+ * is returned.
+ */
+int PathArcs::spfa(int source, Distance* dist, int* parent) const {
+    int* hops = new int[n];
+    bool* queued = new bool[n]();
+    Queue queue(n);
+    dist[source] = 0;
+    hops[source] = 0;
+    queue.enqueue(source);
+    queued[source] = true;
+    Distance sum = 0;
+    int cycle = -1;
+
+    while (!queue.isEmpty() && cycle == -1) {
+        for (int r = queue.size(); r > 1 && dist[queue.peek()] * queue.size() > sum; --r) {
+            queue.enqueue(queue.dequeue());
+        }
+        int u = queue.dequeue();
+        queued[u] = false;
+        sum -= dist[u];
+        for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+            int v = targets[j];
+            Distance candidate = dist[u] + weights[j];
+            if (candidate >= dist[v]) continue;
+            if (queued[v]) sum -= dist[v] - candidate;
+            dist[v] = candidate;
+            parent[v] = u;
+            hops[v] = hops[u] + 1;
+            if (hops[v] >= n) {
+                cycle = v;
+                break;
+            }
+            if (queued[v]) continue;
+            queued[v] = true;
+            sum += candidate;
+            if (!queue.isEmpty() && candidate < dist[queue.peek()]) {
+                queue.enqueueFront(v);
+            } else {
+                queue.enqueue(v);
+            }
+        }
+    }
+    delete[] hops;
+    delete[] queued;
+    return cycle;
+}
+
+/**
+ * @brief Dijkstra over the reduced weights w(u, v) + h(u) - h(v)
+ *
+ * @details dist is one matrix row; it starts at UNREACHABLE_DISTANCE everywhere,
+ * which is larger than any real distance, so no reached flags are needed.
+ * Stale heap entries are skipped by comparing their priority with the
+ * current distance. The reached entries are shifted back to real
+ * distances at the end. parent, if given, receives the predecessor of
+ * every vertex (-1 for the source and unreached vertices). pq is empty on
+ * entry and on return.
+ */
+void PathArcs::dijkstra(int source, const Distance* h, Distance* dist, int* parent, PriorityQueue& pq) const {
+    Distance none = UNREACHABLE_DISTANCE;
+    for (int v = 0; v < n; ++v) dist[v] = none;
+    if (parent) {
+        for (int v = 0; v < n; ++v) parent[v] = -1;
+    }
+    dist[source] = 0;
+    pq.insert(source, 0);
+    while (!pq.isEmpty()) {
+        Distance d = pq.topPriority();
+        int u = pq.extractMin();
+        if (d > dist[u]) continue;
+        for (int j = offsets[u]; j < offsets[u + 1]; ++j) {
+            int v = targets[j];
+            Distance candidate = d + weights[j] + h[u] - h[v];
+            if (candidate < dist[v]) {
+                dist[v] = candidate;
+                if (parent) parent[v] = u;
+                pq.insert(v, candidate);
+            }
+        }
+    }
+    for (int v = 0; v < n; ++v) {
+        if (dist[v] != none) dist[v] += h[v] - h[source];
+    }
+}
+
+// Read-only view of a DirectedGraph that follows edges backwards, so that
+// PathArcs can snapshot the in-adjacency as the transposed graph.
+struct IncomingArcs {
+    const DirectedGraph& g;
+    int getVertexCount() const { return g.getVertexCount(); }
+    int getDegree(int v) const { return g.getInDegree(v); }
+    int getMaxDegree() const { return g.getMaxInDegree(); }
+    int copyNeighbors(int v, Neighbor* out) const { return g.copyInNeighbors(v, out); }
+};
+
+/**
+ * @brief Shortest-path tree toward one target, grown only as far as a query needs
+ *
+ * @details grow() runs Dijkstra from the target over the reversed arcs and
+ * stops as soon as the source is settled. A settled vertex holds its exact
+ * distance to the target in dist and its tree successor in next (-1 at the
+ * target). Every unsettled vertex is at least radius away, so bound(), the
+ * exact distance where settled and radius elsewhere, is a consistent A*
+ * lower bound: along an arc it never drops by more than the arc's weight.
+ * If the heap runs empty first the tree is complete, and unsettled vertices
+ * cannot reach the target at all. The vertices labeled by one query are
+ * listed in touched and reset by the next one, so no query clears O(V).
+ */
+struct ReverseTree {
+    Distance* dist;
+    int* next;
+    bool* settled;
+    int* touched;
+    int touchedCount;
+    bool complete;
+    Distance radius;
+    PriorityQueue pq;
+
+    explicit ReverseTree(int n)
+        : dist(new Distance[n > 0 ? n : 1]), next(new int[n > 0 ? n : 1]),
+          settled(new bool[n > 0 ? n : 1]()), touched(new int[n > 0 ? n : 1]), touchedCount(0),
+          complete(false), radius(0), pq(n > 0 ? n : 1, false, true) {
+        for (int v = 0; v < n; ++v) {
+            dist[v] = UNREACHABLE_DISTANCE;
+            next[v] = -1;
+        }
+    }
+    ~ReverseTree() {
+        delete[] dist;
+        delete[] next;
+        delete[] settled;
+        delete[] touched;
+    }
+    ReverseTree(const ReverseTree&) = delete;
+    ReverseTree& operator=(const ReverseTree&) = delete;
+
+    void grow(const PathArcs& back, int target, int source);
+    bool reaches(int v) const { return settled[v] || !complete; }
+    Distance bound(int v) const { return settled[v] ? dist[v] : radius; }
+};
+
+void ReverseTree::grow(const PathArcs& back, int target, int source) {
+    for (int i = 0; i < touchedCount; ++i) {
+        int v = touched[i];
+        dist[v] = UNREACHABLE_DISTANCE;
+        next[v] = -1;
+        settled[v] = false;
+    }
+    touchedCount = 0;
+    complete = true;
+    radius = 0;
+    dist[target] = 0;
+    touched[touchedCount++] = target;
+    pq.insert(target, 0);
+    while (!pq.isEmpty()) {
+        Distance d = pq.topPriority();
+        int u = pq.extractMin();
+        settled[u] = true;
+        radius = d;
+        if (u == source) {
+            complete = false;
+            break;
+        }
+        for (int j = back.offsets[u]; j < back.offsets[u + 1]; ++j) {
+            int v = back.targets[j];
+            if (settled[v]) continue;
+            Distance candidate = d + back.weights[j];
+            if (dist[v] == UNREACHABLE_DISTANCE) {
+                touched[touchedCount++] = v;
+                dist[v] = candidate;
+                next[v] = u;
+                pq.insert(v, candidate);
+            } else if (candidate < dist[v]) {
+                dist[v] = candidate;
+                next[v] = u;
+                pq.changePriority(v, candidate);
+            }
+        }
+    }
+    while (!pq.isEmpty()) pq.extractMin();
+}
+
+/**
+ * @brief Per-thread workspace for the spur searches of Yen's algorithm
+ *
+ * @details Every search takes a new stamp, and an entry of seen, closed,
+ * blocked, banned or checked counts only if it holds the current stamp, so
+ * nothing is cleared between searches or queries. The caller marks the
+ * root vertices before the spur as blocked and the first hops of earlier
+ * paths as banned, then calls run(). clean caches, per search, whether the
+ * tree path of a vertex avoids the blocked vertices and the spur; chain is
+ * scratch space for filling it. The heap is drained after every search
+ * and reused.
+ */
+struct SpurSearch {
+    int stamp;
+    int* seen;
+    int* closed;
+    int* blocked;
+    int* banned;
+    int* checked;
+    bool* clean;
+    int* chain;
+    int* parent;
+    Distance* cost;
+    PriorityQueue pq;
+
+    SpurSearch(int n, int arcs)
+        : stamp(0), seen(new int[n]()), closed(new int[n]()), blocked(new int[n]()),
+          banned(new int[n]()), checked(new int[n]()), clean(new bool[n]), chain(new int[n]),
+          parent(new int[n]), cost(new Distance[n]), pq(arcs + 1) {}
+    ~SpurSearch() {
+        delete[] seen;
+        delete[] closed;
+        delete[] blocked;
+        delete[] banned;
+        delete[] checked;
+        delete[] clean;
+        delete[] chain;
+        delete[] parent;
+        delete[] cost;
+    }
+    SpurSearch(const SpurSearch&) = delete;
+    SpurSearch& operator=(const SpurSearch&) = delete;
+
+    bool treeClean(const ReverseTree& tree, int v, int spur);
+    int run(const PathArcs& arcs, const ReverseTree& tree, int spur, int*& path, Distance*& pathCost);
+};
+
+// Walks the tree path of v up to the first vertex already classified in
+// this search, then classifies everything walked, so each vertex is
+// walked once per search. Vertices outside the tree are never clean.
+bool SpurSearch::treeClean(const ReverseTree& tree, int v, int spur) {
+    int size = 0;
+    bool result = true;
+    while (v != -1 && checked[v] != stamp) {
+        if (blocked[v] == stamp || v == spur || !tree.settled[v]) {
+            result = false;
+            break;
+        }
+        chain[size++] = v;
+        v = tree.next[v];
+    }
+    if (result && v != -1) result = clean[v];
+    for (int i = 0; i < size; ++i) {
+        checked[chain[i]] = stamp;
+        clean[chain[i]] = result;
+    }
+    return result;
+}
+
+/**
+ * @brief Shortest path from spur to target avoiding the marked vertices and first hops
+ *
+ * @details The tree holds shortest paths to the target in the whole graph.
+ * Removing vertices and arcs only lengthens paths, so tree.bound() stays a
+ * consistent lower bound and A* with it settles each vertex once. A
+ * settled vertex u whose tree path is clean reaches the target at exactly
+ * tree.dist[u] (the target itself is always clean), so the search stops
+ * there and the path continues along the tree. The tree part cannot meet
+ * the searched part, since a vertex on both would have been settled
+ * earlier and been clean. The spur's own tree path is clean only if its
+ * first hop is not banned. Vertices known not to reach the target are
+ * never entered. Returns the number of vertices on the path, spur first,
+ * with path and pathCost (cost from the spur) allocated for the caller, or
+ * 0 if there is none.
+ */
+int SpurSearch::run(const PathArcs& arcs, const ReverseTree& tree, int spur, int*& path,
+                    Distance*& pathCost) {
+    path = nullptr;
+    pathCost = nullptr;
+    if (!tree.reaches(spur)) return 0;
+
+    seen[spur] = stamp;
+    cost[spur] = 0;
+    parent[spur] = -1;
+    int junction = -1;
+    if (tree.settled[spur] && banned[tree.next[spur]] != stamp && treeClean(tree, tree.next[spur], spur)) {
+        junction = spur;
+    } else {
+        pq.insert(spur, tree.bound(spur));
+    }
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin();
+        if (closed[u] == stamp) continue;
+        closed[u] = stamp;
+        if (u != spur && treeClean(tree, u, spur)) {
+            junction = u;
+            break;
+        }
+        for (int j = arcs.offsets[u]; j < arcs.offsets[u + 1]; ++j) {
+            int v = arcs.targets[j];
+            if (blocked[v] == stamp || closed[v] == stamp || !tree.reaches(v)) continue;
+            if (u == spur && banned[v] == stamp) continue;
+            Distance candidate = cost[u] + arcs.weights[j];
+            if (seen[v] != stamp || candidate < cost[v]) {
+                seen[v] = stamp;
+                cost[v] = candidate;
+                parent[v] = u;
+                pq.insert(v, candidate + tree.bound(v));
+            }
+        }
+    }
+    while (!pq.isEmpty()) pq.extractMin();
+    if (junction == -1) return 0;
+
+    int searched = 0;
+    for (int v = junction; v != -1; v = parent[v]) searched++;
+    int length = searched;
+    for (int v = tree.next[junction]; v != -1; v = tree.next[v]) length++;
+    path = new int[length];
+    pathCost = new Distance[length];
+    int i = searched;
+    for (int v = junction; v != -1; v = parent[v]) {
+        path[--i] = v;
+        pathCost[i] = cost[v];
+    }
+    i = searched;
+    for (int v = tree.next[junction]; v != -1; v = tree.next[v], ++i) {
+        path[i] = v;
+        pathCost[i] = cost[junction] + tree.dist[junction] - tree.dist[v];
+    }
+    return length;
+}
+
+template<typename T>
+static void grow(T*& array, int used, int capacity) {
+    T* larger = new T[capacity];
+    for (int i = 0; i < used; ++i) larger[i] = array[i];
+    delete[] array;
+    array = larger;
+}
+
+/**
+ * @brief Growing list of paths stored back to back
+ *
+ * @details Path p is vertices[offsets[p] .. offsets[p+1]), prefix holds
+ * the cost from the first vertex up to each vertex, and deviation is the
+ * index of the vertex where the path left the path it was derived from.
+ * taken marks candidates that have been accepted, and hash is a hash of
+ * the vertex sequence that settles most duplicate checks without a scan.
+ */
+struct PathList {
+    int count;
+    int capacity;
+    int used;
+    int room;
+    int* offsets;
+    int* vertices;
+    Distance* prefix;
+    int* deviation;
+    bool* taken;
+    unsigned* hash;
+
+    PathList()
+        : count(0), capacity(4), used(0), room(64), offsets(new int[4]), vertices(new int[64]),
+          prefix(new Distance[64]), deviation(new int[4]), taken(new bool[4]), hash(new unsigned[4]) {
+        offsets[0] = 0;
+    }
+    ~PathList() {
+        delete[] offsets;
+        delete[] vertices;
+        delete[] prefix;
+        delete[] deviation;
+        delete[] taken;
+        delete[] hash;
+    }
+    PathList(const PathList&) = delete;
+    PathList& operator=(const PathList&) = delete;
+
+    int length(int p) const { return offsets[p + 1] - offsets[p]; }
+    Distance cost(int p) const { return prefix[offsets[p + 1] - 1]; }
+
+    // Appends an empty path of 'size' vertices and returns its first slot
+    int add(int size, int from) {
+        if (count + 2 > capacity) {
+            capacity *= 2;
+            grow(offsets, count + 1, capacity);
+            grow(deviation, count, capacity);
+            grow(taken, count, capacity);
+            grow(hash, count, capacity);
+        }
+        if (used + size > room) {
+            while (used + size > room) room *= 2;
+            grow(vertices, used, room);
+            grow(prefix, used, room);
+        }
+        deviation[count] = from;
+        taken[count] = false;
+        offsets[++count] = used + size;
+        int start = used;
+        used += size;
+        return start;
+    }
+
+    // Must be called once the vertices of the last path are filled in
+    void finishLast() {
+        unsigned h = 2166136261u;
+        for (int i = offsets[count - 1]; i < offsets[count]; ++i) {
+            h = (h ^ static_cast<unsigned>(vertices[i])) * 16777619u;
+        }
+        hash[count - 1] = h;
+    }
+
+    void removeLast() {
+        count--;
+        used = offsets[count];
+    }
+
+    bool sameAs(int p, int q) const {
+        if (hash[p] != hash[q] || length(p) != length(q) || cost(p) != cost(q)) return false;
+        for (int i = 0; i < length(p); ++i) {
+            if (vertices[offsets[p] + i] != vertices[offsets[q] + i]) return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Relax the tile rows [i0, i1) x columns [j0, j1) through k in [k0, k1)
+ *
+ * @details k is the outer loop, so the update is correct even when the tile
+ * overlaps the row or column tile of k. Rows whose entry (i, k) is
+ * unreachable are skipped; an entry (k, j) may be unreachable, and the sum
+ * then stays above half of UNREACHABLE_DISTANCE, which the caller treats as
+ * unreachable. The innermost loop is a branch-free min over contiguous
+ * entries, written so that it vectorizes.
+ */
+static void relaxTile(Distance* d, int n, int i0, int i1, int j0, int j1, int k0, int k1) {
+    Distance half = UNREACHABLE_DISTANCE / 2;
+    for (int k = k0; k < k1; ++k) {
+        const Distance* rowK = d + static_cast<long long>(k) * n;
+        for (int i = i0; i < i1; ++i) {
+            Distance* rowI = d + static_cast<long long>(i) * n;
+            Distance viaK = rowI[k];
+            if (viaK >= half) continue;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for (int j = j0; j < j1; ++j) {
+                Distance candidate = viaK + rowK[j];
+                rowI[j] = candidate < rowI[j] ? candidate : rowI[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Blocked Floyd-Warshall over the matrix in place
+ *
+ * @details For tile round b, the diagonal tile is relaxed one k at a time,
+ * first checking d(k, k): before round k it is the shortest cycle through k
+ * over vertices below k, so the first negative cycle shows up there before
+ * any value can grow without bound. The row and column tiles of b only
+ * depend on the diagonal tile, and the other tiles on one row and one
+ * column tile, so both steps run in parallel. Entries above half of
+ * UNREACHABLE_DISTANCE are reset to it at the end. Returns false on a
+ * negative cycle.
+ */
+static bool closeTiles(Distance* d, int n) {
+    int tiles = (n + TILE - 1) / TILE;
+    for (int b = 0; b < tiles; ++b) {
+        int k0 = b * TILE;
+        int k1 = k0 + TILE < n ? k0 + TILE : n;
+        for (int k = k0; k < k1; ++k) {
+            if (isNegative(d[static_cast<long long>(k) * n + k])) return false;
+            relaxTile(d, n, k0, k1, k0, k1, k, k + 1);
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (int t = 0; t < 2 * tiles; ++t) {
+            int other = t / 2;
+            if (other == b) continue;
+            int o0 = other * TILE;
+            int o1 = o0 + TILE < n ? o0 + TILE : n;
+            if (t % 2 == 0) {
+                relaxTile(d, n, k0, k1, o0, o1, k0, k1);
+            } else {
+                relaxTile(d, n, o0, o1, k0, k1, k0, k1);
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (int t = 0; t < tiles * tiles; ++t) {
+            int row = t / tiles;
+            int column = t % tiles;
+            if (row == b || column == b) continue;
+            int i0 = row * TILE;
+            int j0 = column * TILE;
+            relaxTile(d, n, i0, i0 + TILE < n ? i0 + TILE : n, j0, j0 + TILE < n ? j0 + TILE : n,
+                      k0, k1);
+        }
+    }
+
+    Distance none = UNREACHABLE_DISTANCE;
+    long long cells = static_cast<long long>(n) * n;
+    for (long long c = 0; c < cells; ++c) {
+        if (c % (n + 1) == 0 && isNegative(d[c])) return false;
+        if (d[c] >= none / 2) d[c] = none;
+    }
+    return true;
+}
+
+template<typename G>
+static DistanceMatrix floydWarshallOf(const G& g) {
+    PathArcs arcs(g);
+    int n = arcs.n;
+    DistanceMatrix matrix(n);
+    Distance* d = matrix.data();
+    for (int u = 0; u < n; ++u) {
+        Distance* row = d + static_cast<long long>(u) * n;
+        row[u] = 0;
+        for (int j = arcs.offsets[u]; j < arcs.offsets[u + 1]; ++j) {
+            int v = arcs.targets[j];
+            if (arcs.weights[j] < row[v]) row[v] = arcs.weights[j];
+        }
+    }
+    if (!closeTiles(d, n))
+        throw GraphException("Graph contains a negative cycle");
+    return matrix;
+}
+
+template<typename G>
+static DistanceMatrix johnsonOf(const G& g) {
+    PathArcs arcs(g);
+    int n = arcs.n;
+    Distance* h = new Distance[n > 0 ? n : 1]();
+    if (arcs.negative && arcs.bellmanFord(h, nullptr) != -1) {
+        delete[] h;
+        throw GraphException("Graph contains a negative cycle");
+    }
+
+    DistanceMatrix matrix(n);
+    Distance* d = matrix.data();
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        PriorityQueue pq(arcs.offsets[n] + 1);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+        for (int s = 0; s < n; ++s) {
+            arcs.dijkstra(s, h, d + static_cast<long long>(s) * n, nullptr, pq);
+        }
+    }
+    delete[] h;
+    return matrix;
+}
+
+template<typename G>
+static Distance* singleSource(const G& g, int source, int*& parent, bool queueBased) {
+    PathArcs arcs(g);
+    int n = arcs.n;
+    if (source < 0 || source >= n)
+        throw GraphException("Vertex index out of bounds");
+    Distance* dist = new Distance[n];
+    parent = new int[n];
+    for (int v = 0; v < n; ++v) {
+        dist[v] = UNREACHABLE_DISTANCE;
+        parent[v] = -1;
+    }
+    int cycle;
+    if (queueBased) {
+        cycle = arcs.spfa(source, dist, parent);
+    } else {
+        dist[source] = 0;
+        cycle = arcs.bellmanFord(dist, parent);
+    }
+    if (cycle != -1) {
+        delete[] dist;
+        delete[] parent;
+        parent = nullptr;
+        throw GraphException("Graph contains a negative cycle");
+    }
+    return dist;
+}
+
+/**
+ * @brief Negative cycle from Bellman-Ford with a virtual source
+ *
+ * @details Every vertex starts at distance 0. The vertex changed in round V
+ * has a chain of predecessors that enters a negative cycle within V steps,
+ * so V steps back from it land on the cycle, which is then read backwards
+ * through the predecessors and reversed into edge order.
+ */
+template<typename G>
+static int* cycleOf(const G& g, int& length) {
+    PathArcs arcs(g);
+    int n = arcs.n;
+    length = 0;
+    Distance* dist = new Distance[n > 0 ? n : 1]();
+    int* parent = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) parent[v] = -1;
+    int v = arcs.negative ? arcs.bellmanFord(dist, parent) : -1;
+    int* cycle = nullptr;
+    if (v != -1) {
+        for (int i = 0; i < n; ++i) v = parent[v];
+        cycle = new int[n];
+        int u = v;
+        do {
+            cycle[length++] = u;
+            u = parent[u];
+        } while (u != v);
+        for (int i = 0, j = length - 1; i < j; ++i, --j) swap(cycle[i], cycle[j]);
+    }
+    delete[] dist;
+    delete[] parent;
+    return cycle;
+}
+
+Distance* ShortestPaths::bellmanFord(const Graph& g, int source, int*& parent) {
+    return singleSource(g, source, parent, false);
+}
+
+Distance* ShortestPaths::bellmanFord(const DirectedGraph& g, int source, int*& parent) {
+    return singleSource(g, source, parent, false);
+}
+
+Distance* ShortestPaths::spfa(const Graph& g, int source, int*& parent) {
+    return singleSource(g, source, parent, true);
+}
+
+Distance* ShortestPaths::spfa(const DirectedGraph& g, int source, int*& parent) {
+    return singleSource(g, source, parent, true);
+}
+
+int* ShortestPaths::negativeCycle(const Graph& g, int& length) {
+    return cycleOf(g, length);
+}
+
+int* ShortestPaths::negativeCycle(const DirectedGraph& g, int& length) {
+    return cycleOf(g, length);
+}
+
+KShortestPaths::KShortestPaths(const Graph& g)
+    : n(0), arcs(new PathArcs(g)), reverseArcs(nullptr), tree(nullptr), workspaces(nullptr), threads(0) {
+    prepare();
+}
+
+KShortestPaths::KShortestPaths(const DirectedGraph& g)
+    : n(0), arcs(new PathArcs(g)), reverseArcs(nullptr), tree(nullptr), workspaces(nullptr), threads(0) {
+    IncomingArcs in = {g};
+    reverseArcs = new PathArcs(in);
+    prepare();
+}
+
+void KShortestPaths::prepare() {
+    if (arcs->negative) {
+        delete arcs;
+        delete reverseArcs;
+        throw GraphException("Edge weights must not be negative");
+    }
+    n = arcs->n;
+    tree = new ReverseTree(n);
+    threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    workspaces = new SpurSearch*[threads];
+    for (int t = 0; t < threads; ++t) workspaces[t] = nullptr;
+}
+
+KShortestPaths::~KShortestPaths() {
+    for (int t = 0; t < threads; ++t) delete workspaces[t];
+    delete[] workspaces;
+    delete tree;
+    delete arcs;
+    delete reverseArcs;
+}
+
+/**
+ * @brief Yen's algorithm with Lawler's restriction and a shared reverse tree
+ *
+ * @details The reverse tree is grown from the target until it settles the
+ * source, and the first path follows it from the source. Each iteration
+ * takes the last accepted path and searches, in parallel, the spur
+ * vertices from its deviation index on, each thread with its own
+ * SpurSearch (created on the thread's first spur, and grown in number if
+ * the thread limit was raised since the last query). shared[q] is the
+ * number of leading vertices accepted path q has in common with the last
+ * one, so the spur at index i bans the next hop of every path with
+ * shared[q] > i. The results are appended to the candidates in spur order,
+ * duplicates dropped, and the shortest candidate (fewest vertices, then
+ * earliest, on ties) is accepted next.
+ */
+int KShortestPaths::find(int source, int target, int k, int*& offsets, int*& vertices,
+                         Distance*& lengths) {
+    if (source < 0 || source >= n || target < 0 || target >= n)
+        throw GraphException("Vertex index out of bounds");
+    if (k < 0)
+        throw GraphException("Path count must not be negative");
+
+    PathList accepted;
+    PathList candidates;
+    if (k > 0) {
+        tree->grow(reverseArcs ? *reverseArcs : *arcs, target, source);
+        if (tree->settled[source]) {
+            int size = 0;
+            for (int v = source; v != -1; v = tree->next[v]) size++;
+            int at = accepted.add(size, 0);
+            for (int v = source; v != -1; v = tree->next[v], ++at) {
+                accepted.vertices[at] = v;
+                accepted.prefix[at] = tree->dist[source] - tree->dist[v];
+            }
+            accepted.finishLast();
+        }
+    }
+    int* shared = new int[k > 0 ? k : 1];
+
+    int wanted = 1;
+#ifdef _OPENMP
+    wanted = omp_get_max_threads();
+#endif
+    if (wanted > threads) {
+        SpurSearch** larger = new SpurSearch*[wanted];
+        for (int t = 0; t < wanted; ++t) larger[t] = t < threads ? workspaces[t] : nullptr;
+        delete[] workspaces;
+        workspaces = larger;
+        threads = wanted;
+    }
+
+    while (accepted.count > 0 && accepted.count < k) {
+        int last = accepted.count - 1;
+        const int* path = accepted.vertices + accepted.offsets[last];
+        int first = accepted.deviation[last];
+        int spurs = accepted.length(last) - 1 - first;
+        int** found = new int*[spurs > 0 ? spurs : 1];
+        Distance** foundCost = new Distance*[spurs > 0 ? spurs : 1];
+        int* foundLength = new int[spurs > 0 ? spurs : 1];
+        for (int q = 0; q < accepted.count; ++q) {
+            const int* other = accepted.vertices + accepted.offsets[q];
+            int limit = accepted.length(q) < accepted.length(last) ? accepted.length(q) : accepted.length(last);
+            shared[q] = 0;
+            while (shared[q] < limit && other[shared[q]] == path[shared[q]]) shared[q]++;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (int s = 0; s < spurs; ++s) {
+            int t = 0;
+#ifdef _OPENMP
+            t = omp_get_thread_num();
+#endif
+            if (!workspaces[t]) workspaces[t] = new SpurSearch(n, arcs->offsets[n]);
+            SpurSearch& ws = *workspaces[t];
+            int i = first + s;
+            ws.stamp++;
+            for (int j = 0; j < i; ++j) ws.blocked[path[j]] = ws.stamp;
+            for (int q = 0; q < accepted.count; ++q) {
+                if (shared[q] > i && accepted.length(q) > i + 1) {
+                    ws.banned[accepted.vertices[accepted.offsets[q] + i + 1]] = ws.stamp;
+                }
+            }
+            foundLength[s] = ws.run(*arcs, *tree, path[i], found[s], foundCost[s]);
+        }
+
+        for (int s = 0; s < spurs; ++s) {
+            if (foundLength[s] == 0) continue;
+            int i = first + s;
+            Distance rootCost = accepted.prefix[accepted.offsets[last] + i];
+            int at = candidates.add(i + foundLength[s], i);
+            for (int j = 0; j < i; ++j, ++at) {
+                candidates.vertices[at] = accepted.vertices[accepted.offsets[last] + j];
+                candidates.prefix[at] = accepted.prefix[accepted.offsets[last] + j];
+            }
+            for (int j = 0; j < foundLength[s]; ++j, ++at) {
+                candidates.vertices[at] = found[s][j];
+                candidates.prefix[at] = rootCost + foundCost[s][j];
+            }
+            delete[] found[s];
+            delete[] foundCost[s];
+            candidates.finishLast();
+            int added = candidates.count - 1;
+            for (int c = 0; c < added; ++c) {
+                if (!candidates.taken[c] && candidates.sameAs(c, added)) {
+                    candidates.removeLast();
+                    break;
+                }
+            }
+        }
+        delete[] found;
+        delete[] foundCost;
+        delete[] foundLength;
+
+        int best = -1;
+        for (int c = 0; c < candidates.count; ++c) {
+            if (candidates.taken[c]) continue;
+            if (best == -1 || candidates.cost(c) < candidates.cost(best) ||
+                (candidates.cost(c) == candidates.cost(best) && candidates.length(c) < candidates.length(best))) {
+                best = c;
+            }
+        }
+        if (best == -1) break;
+        candidates.taken[best] = true;
+        int size = candidates.length(best);
+        int at = accepted.add(size, candidates.deviation[best]);
+        for (int j = 0; j < size; ++j) {
+            accepted.vertices[at + j] = candidates.vertices[candidates.offsets[best] + j];
+            accepted.prefix[at + j] = candidates.prefix[candidates.offsets[best] + j];
+        }
+        accepted.finishLast();
+    }
+    delete[] shared;
+
+    int count = accepted.count;
+    offsets = new int[count + 1];
+    vertices = new int[accepted.used > 0 ? accepted.used : 1];
+    lengths = new Distance[count > 0 ? count : 1];
+    for (int p = 0; p <= count; ++p) offsets[p] = accepted.offsets[p];
+    for (int i = 0; i < accepted.used; ++i) vertices[i] = accepted.vertices[i];
+    for (int p = 0; p < count; ++p) lengths[p] = accepted.cost(p);
+    return count;
+}
+
+int ShortestPaths::kShortestPaths(const Graph& g, int source, int target, int k, int*& offsets,
+                                  int*& vertices, Distance*& lengths) {
+    KShortestPaths query(g);
+    return query.find(source, target, k, offsets, vertices, lengths);
+}
+
+int ShortestPaths::kShortestPaths(const DirectedGraph& g, int source, int target, int k,
+                                  int*& offsets, int*& vertices, Distance*& lengths) {
+    KShortestPaths query(g);
+    return query.find(source, target, k, offsets, vertices, lengths);
+}
+
+DistanceMatrix ShortestPaths::floydWarshall(const Graph& g) {
+    return floydWarshallOf(g);
+}
+
+DistanceMatrix ShortestPaths::floydWarshall(const DirectedGraph& g) {
+    return floydWarshallOf(g);
+}
+
+DistanceMatrix ShortestPaths::johnson(const Graph& g) {
+    return johnsonOf(g);
+}
+
+DistanceMatrix ShortestPaths::johnson(const DirectedGraph& g) {
+    return johnsonOf(g);
+}
+
+} // namespace graph
@@ -0,0 +1,248 @@
+/** @author meirshuker159@gmail.com */
+
+
+#include "Triangles.h"
+#include "Graph.h"
+#include "GraphException.h"
+#include "GraphInternal.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace graph {
+
+// Degree-ordered adjacency: the distinct neighbors of v (self excluded) are
+// ids[start[v] .. end[v]), the lower-ranked ones before split[v] and the
+// higher-ranked ones from it, each part sorted by ID.
+struct OrderedAdjacency {
+    int n;
+    int* start;
+    int* split;
+    int* end;
+    int* ids;
+
+    explicit OrderedAdjacency(const Graph& g);
+    ~OrderedAdjacency() {
+        delete[] start;
+        delete[] split;
+        delete[] end;
+        delete[] ids;
+    }
+    OrderedAdjacency(const OrderedAdjacency&) = delete;
+    OrderedAdjacency& operator=(const OrderedAdjacency&) = delete;
+
+    int lowCount(int v) const { return split[v] - start[v]; }
+    int highCount(int v) const { return end[v] - split[v]; }
+};
+
+/**
+ * @brief Build the degree-ordered view of a graph
+ *
+ * @details Ranks come from a stable counting sort on degree, so ties are
+ * broken by vertex ID. The lists start as a CSR snapshot without self-loops,
+ * whose offsets and targets become start and ids; every vertex then sorts
+ * and deduplicates its own list in place. The vertices are independent and
+ * are processed in parallel under OpenMP with one scratch buffer per thread.
+ */
+OrderedAdjacency::OrderedAdjacency(const Graph& g)
+    : n(g.getVertexCount()), start(nullptr), split(new int[n > 0 ? n : 1]),
+      end(new int[n > 0 ? n : 1]), ids(nullptr) {
+    int maxDeg = g.getMaxDegree();
+    int* bucket = new int[maxDeg + 2]();
+    for (int v = 0; v < n; ++v) {
+        bucket[g.getDegree(v) + 1]++;
+    }
+    for (int d = 0; d <= maxDeg; ++d) {
+        bucket[d + 1] += bucket[d];
+    }
+    int* rank = new int[n > 0 ? n : 1];
+    for (int v = 0; v < n; ++v) {
+        rank[v] = bucket[g.getDegree(v)]++;
+    }
+    delete[] bucket;
+
+    CsrSnapshot lists(g, false, true);
+    start = lists.offsets;
+    ids = lists.targets;
+    lists.offsets = nullptr;
+    lists.targets = nullptr;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        int* high = new int[maxDeg + 1];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+        for (int v = 0; v < n; ++v) {
+            int* list = ids + start[v];
+            int size = start[v + 1] - start[v];
+            sortInts(list, size);
+
+            // Deduplicate, keeping lower-ranked IDs in place and moving the
+            // higher-ranked ones aside; both parts stay sorted
+            int low = 0, highCount = 0;
+            for (int i = 0; i < size; ++i) {
+                int u = list[i];
+                if (i > 0 && u == list[i - 1]) continue;
+                if (rank[u] < rank[v]) list[low++] = u;
+                else high[highCount++] = u;
+            }
+            for (int i = 0; i < highCount; ++i) {
+                list[low + i] = high[i];
+            }
+            split[v] = start[v] + low;
+            end[v] = split[v] + highCount;
+        }
+        delete[] high;
+    }
+    delete[] rank;
+}
+
+/**
+ * @brief Count the common elements of two sorted arrays
+ *
+ * @details The vector paths compare a block of a against every rotation of a
+ * block of b (8 x 8 lanes with AVX2, 4 x 4 with SSE2), so all pairs of the
+ * two blocks are checked with no data-dependent branches. The block whose
+ * last element is smaller is then advanced (both if equal). Since neither
+ * array has duplicates, a pair of equal values is only ever compared in one
+ * iteration. The remainder is finished by a scalar merge.
+ */
+int Triangles::intersectCount(const int* a, int na, const int* b, int nb) {
+    int i = 0, j = 0, common = 0;
+#if defined(__AVX2__)
+    const __m256i rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while (i + 8 <= na && j + 8 <= nb) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+        __m256i match = _mm256_cmpeq_epi32(va, vb);
+        for (int r = 1; r < 8; ++r) {
+            vb = _mm256_permutevar8x32_epi32(vb, rotate);
+            match = _mm256_or_si256(match, _mm256_cmpeq_epi32(va, vb));
+        }
+        common += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+        int lastA = a[i + 7], lastB = b[j + 7];
+        if (lastA <= lastB) i += 8;
+        if (lastB <= lastA) j += 8;
+    }
+#elif defined(__SSE2__)
+    while (i + 4 <= na && j + 4 <= nb) {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i match = _mm_cmpeq_epi32(va, vb);
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, vb));
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, vb));
+        vb = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, vb));
+        common += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(match)));
+        int lastA = a[i + 3], lastB = b[j + 3];
+        if (lastA <= lastB) i += 4;
+        if (lastB <= lastA) j += 4;
+    }
+#endif
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            ++i;
+        } else if (b[j] < a[i]) {
+            ++j;
+        } else {
+            ++common;
+            ++i;
+            ++j;
+        }
+    }
+    return common;
+}
+
+// Each triangle x < v < w (by rank) is counted once, at x
+static long long countTriangles(const OrderedAdjacency& adj) {
+    long long total = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : total)
+#endif
+    for (int x = 0; x < adj.n; ++x) {
+        const int* highX = adj.ids + adj.split[x];
+        int nx = adj.highCount(x);
+        for (int k = 0; k < nx; ++k) {
+            int v = highX[k];
+            total += Triangles::intersectCount(highX, nx, adj.ids + adj.split[v], adj.highCount(v));
+        }
+    }
+    return total;
+}
+
+// Vertex x is the lowest, middle or highest ranked corner of each of its
+// triangles, and each role is one intersection per edge:
+// - lowest  (x < v < w): high(x) with high(v) for v in high(x)
+// - middle  (u < x < w): high(u) with high(x) for u in low(x)
+// - highest (u < v < x): high(u) with low(x)  for u in low(x)
+// Every vertex only writes its own count, so the loop needs no atomics.
+static void countPerVertex(const OrderedAdjacency& adj, long long* counts) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64)
+#endif
+    for (int x = 0; x < adj.n; ++x) {
+        const int* lowX = adj.ids + adj.start[x];
+        const int* highX = adj.ids + adj.split[x];
+        int nLow = adj.lowCount(x);
+        int nHigh = adj.highCount(x);
+        long long t = 0;
+        for (int k = 0; k < nHigh; ++k) {
+            int v = highX[k];
+            t += Triangles::intersectCount(highX, nHigh, adj.ids + adj.split[v], adj.highCount(v));
+        }
+        for (int k = 0; k < nLow; ++k) {
+            int u = lowX[k];
+            const int* highU = adj.ids + adj.split[u];
+            int nu = adj.highCount(u);
+            t += Triangles::intersectCount(highU, nu, highX, nHigh);
+            t += Triangles::intersectCount(highU, nu, lowX, nLow);
+        }
+        counts[x] = t;
+    }
+}
+
+long long Triangles::count(const Graph& g) {
+    OrderedAdjacency adj(g);
+    return countTriangles(adj);
+}
+
+long long* Triangles::perVertex(const Graph& g) {
+    OrderedAdjacency adj(g);
+    long long* counts = new long long[adj.n];
+    countPerVertex(adj, counts);
+    return counts;
+}
+
+double* Triangles::localClustering(const Graph& g) {
+    OrderedAdjacency adj(g);
+    long long* counts = new long long[adj.n];
+    countPerVertex(adj, counts);
+    double* coefficients = new double[adj.n];
+    for (int v = 0; v < adj.n; ++v) {
+        long long d = adj.end[v] - adj.start[v];
+        coefficients[v] = d < 2 ? 0.0 : 2.0 * counts[v] / (d * (d - 1));
+    }
+    delete[] counts;
+    return coefficients;
+}
+
+double Triangles::transitivity(const Graph& g) {
+    OrderedAdjacency adj(g);
+    long long triangles = countTriangles(adj);
+    long long triples = 0;
+    for (int v = 0; v < adj.n; ++v) {
+        long long d = adj.end[v] - adj.start[v];
+        triples += d * (d - 1) / 2;
+    }
+    return triples == 0 ? 0.0 : 3.0 * triangles / triples;
+}
+
+} // namespace graph
@@ -12,10 +12,25 @@
  * @param cap Maximum capacity of the priority queue
  * @throws GraphException if cap <= 0
  */
-PriorityQueue::PriorityQueue(int cap) : capacity(cap), size(0) {
+PriorityQueue::PriorityQueue(int cap) : PriorityQueue(cap, false, false) {}
+
+/**
+ * @brief Constructor - Initialize a min- or max-heap, optionally indexed
+ *
+ * @param cap Maximum capacity of the priority queue
+ * @param max Whether the highest priority is extracted first
+ * @param indexed Whether to track the heap position of every value
+ * @throws GraphException if cap <= 0
+ */
+PriorityQueue::PriorityQueue(int cap, bool max, bool indexed)
+    : heap(nullptr), position(nullptr), capacity(cap), size(0), maxHeap(max) {
     if (cap <= 0)
         throw graph::GraphException("Priority Queue capacity must be positive");
     heap = new Element[capacity];
+    if (indexed) {
+        position = new int[capacity];
+        for (int i = 0; i < capacity; ++i) position[i] = -1;
+    }
 }
 
 /**
@@ -26,6 +41,7 @@ PriorityQueue::PriorityQueue(int cap) : capacity(cap), size(0) {
  */
 PriorityQueue::~PriorityQueue() {
     delete[] heap;
+    delete[] position;
 }
 
 /**
@@ -44,9 +60,16 @@ PriorityQueue::~PriorityQueue() {
  * @param priority Priority of the element (lower = higher precedence)
  * @throws GraphException if the priority queue is at maximum capacity
  */
-void PriorityQueue::insert(int value, int priority) {
+void PriorityQueue::insert(int value, graph::Distance priority) {
     if (size == capacity)
         throw graph::GraphException("Priority Queue is full");
+    if (position) {
+        if (value < 0 || value >= capacity)
+            throw graph::GraphException("Priority Queue value out of range");
+        if (position[value] != -1)
+            throw graph::GraphException("Priority Queue value already queued");
+        position[value] = size;
+    }
 
     heap[size] = {value, priority};
     heapifyUp(size);
@@ -71,13 +94,72 @@ void PriorityQueue::insert(int value, int priority) {
  * @throws GraphException if the priority queue is empty
  */
 int PriorityQueue::extractMin() {
+    return extractTop();
+}
+
+/**
+ * @brief Extract and return the element at the root of the heap
+ *
+ * Same steps as extractMin(), which it implements; the root holds the minimum
+ * of a min-heap and the maximum of a max-heap.
+ *
+ * @return The value of the top element
+ * @throws GraphException if the priority queue is empty
+ */
+int PriorityQueue::extractTop() {
     if (isEmpty())
         throw graph::GraphException("Priority Queue is empty");
 
-    int minValue = heap[0].value;
-    heap[0] = heap[--size];  // Move last element to root and decrement size
-    heapifyDown(0);          // Restore heap property
-    return minValue;
+    int topValue = heap[0].value;
+    swapElements(0, --size);  // Move last element to root and decrement size
+    if (position) position[topValue] = -1;
+    heapifyDown(0);           // Restore heap property
+    return topValue;
+}
+
+/**
+ * @brief Priority of the root element
+ *
+ * @throws GraphException if the priority queue is empty
+ */
+graph::Distance PriorityQueue::topPriority() const {
+    if (isEmpty())
+        throw graph::GraphException("Priority Queue is empty");
+    return heap[0].priority;
+}
+
+/**
+ * @brief Check if a value is queued, using the position index
+ *
+ * @throws GraphException if the queue is not indexed
+ */
+bool PriorityQueue::contains(int value) const {
+    if (!position)
+        throw graph::GraphException("Priority Queue is not indexed");
+    return value >= 0 && value < capacity && position[value] != -1;
+}
+
+graph::Distance PriorityQueue::priorityOf(int value) const {
+    checkQueued(value);
+    return heap[position[value]].priority;
+}
+
+/**
+ * @brief Change the priority of a queued value in place
+ *
+ * @details The element is found through the position index and then moved
+ * towards the root or the leaves, depending on how its precedence changed.
+ *
+ * @param value A queued value
+ * @param priority Its new priority
+ * @throws GraphException if the queue is not indexed or value is not queued
+ */
+void PriorityQueue::changePriority(int value, graph::Distance priority) {
+    checkQueued(value);
+    int i = position[value];
+    heap[i].priority = priority;
+    heapifyUp(i);
+    heapifyDown(position[value]);
 }
 
 /**
@@ -89,8 +171,26 @@ bool PriorityQueue::isEmpty() const {
     return size == 0;
 }
 
+void PriorityQueue::checkQueued(int value) const {
+    if (!contains(value))
+        throw graph::GraphException("Priority Queue value is not queued");
+}
+
+// Strictly ahead in heap order, so equal priorities are never swapped
+bool PriorityQueue::precedes(int i, int j) const {
+    return maxHeap ? heap[i].priority > heap[j].priority : heap[i].priority < heap[j].priority;
+}
+
+void PriorityQueue::swapElements(int i, int j) {
+    graph::swap(heap[i], heap[j]);
+    if (position) {
+        position[heap[i].value] = i;
+        position[heap[j].value] = j;
+    }
+}
+
 /**
- * @brief Restore min-heap property by moving element up the tree
+ * @brief Restore heap property by moving element up the tree
  *
  * Helper function that moves an element up the heap tree until the
  * min-heap property is satisfied. Used after insertion.
@@ -103,14 +203,14 @@ bool PriorityQueue::isEmpty() const {
  * @param i Index of the element to heapify up
  */
 void PriorityQueue::heapifyUp(int i) {
-    while (i > 0 && heap[i].priority < heap[(i - 1) / 2].priority) {
-        graph::swap(heap[i], heap[(i - 1) / 2]);
+    while (i > 0 && precedes(i, (i - 1) / 2)) {
+        swapElements(i, (i - 1) / 2);
         i = (i - 1) / 2;  // Move to parent index
     }
 }
 
 /**
- * @brief Restore min-heap property by moving element down the tree
+ * @brief Restore heap property by moving element down the tree
  *
  * Helper function that moves an element down the heap tree until the
  * min-heap property is satisfied. Used after extraction.
@@ -128,14 +228,14 @@ void PriorityQueue::heapifyDown(int i) {
     int smallest = i;        // Index of element with smallest priority
 
     // Find child with minimum priority
-    if (left < size && heap[left].priority < heap[smallest].priority)
+    if (left < size && precedes(left, smallest))
         smallest = left;
-    if (right < size && heap[right].priority < heap[smallest].priority)
+    if (right < size && precedes(right, smallest))
         smallest = right;
 
     // If current element is not the smallest, swap and continue
     if (smallest != i) {
-        graph::swap(heap[i], heap[smallest]);
+        swapElements(i, smallest);
         heapifyDown(smallest);  // Recursive call
     }
 }
@@ -86,6 +86,50 @@ int Queue::dequeue() {
     return value;
 }
 
+/**
+ * @brief Add an element to the front of the queue
+ * 
+ * Steps the front pointer back in circular fashion and stores the value
+ * there, so it is dequeued before all current elements.
+ * 
+ * @param value The integer value to add to the queue
+ * @throws GraphException if the queue is at maximum capacity
+ * 
+ * @complexity Time: O(1), Space: O(1)
+ */
+void Queue::enqueueFront(int value) {
+    if (count == capacity) 
+        throw graph::GraphException("Queue is full");
+    
+    front = (front + capacity - 1) % capacity;  // Circular decrement
+    data[front] = value;
+    count++;
+}
+
+/**
+ * @brief Return the front element without removing it
+ * 
+ * @return The value of the front element
+ * @throws GraphException if the queue is empty
+ * 
+ * @complexity Time: O(1), Space: O(1)
+ */
+int Queue::peek() const {
+    if (isEmpty()) 
+        throw graph::GraphException("Queue is empty");
+    
+    return data[front];
+}
+
+/**
+ * @brief Number of elements currently in the queue
+ * 
+ * @complexity Time: O(1), Space: O(1)
+ */
+int Queue::size() const {
+    return count;
+}
+
 /**
  * @brief Check if the queue is empty
  * 